@@ -47,7 +47,10 @@ class bidirectional_iterator : public ft::iterator_traits<ft::iterator<std::bidi
 			return (bidirectional_iterator<Node, const value_type>(this->_iter));
 		}
 
-		value_type *base()
+		/*
+		** @return the node the iterator points to
+		*/
+		Node *base() const
 		{
 			return (this->_iter);
 		}
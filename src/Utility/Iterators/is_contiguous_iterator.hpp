@@ -0,0 +1,90 @@
+/*
+** Trait class that identifies whether an iterator walks over contiguous memory,
+** i.e. [first, last) can be seen as [address(first), address(first) + (last - first)).
+** The containers use it to copy such ranges with a single memcpy.
+**
+** |--------------------------------|-----------------------------|
+** | iterator                       | element_type                |
+** |--------------------------------|-----------------------------|
+** | T*                             | T                           |
+** | const T*                       | T                           |
+** | ft::random_access_iterator<T>  | T (without const)           |
+** |--------------------------------|-----------------------------|
+**
+** C++98 iterators don't say whether they are contiguous, so every other
+** iterator (std::vector<T>::iterator included) is conservatively considered as not contiguous.
+*/
+
+# pragma once
+
+# include "./random_access_iterator.hpp"
+
+namespace ft
+{
+
+template <class Iterator>
+struct is_contiguous_iterator
+{
+    typedef Iterator    type;
+    typedef void        element_type;
+
+    static const bool	value = false;
+};
+
+template <class T>
+struct is_contiguous_iterator<T*>
+{
+    typedef T*          type;
+    typedef T           element_type;
+
+    static const bool	value = true;
+
+    static const T	*address(T *it)
+    {
+        return (it);
+    }
+};
+
+template <class T>
+struct is_contiguous_iterator<const T*>
+{
+    typedef const T*    type;
+    typedef T           element_type;
+
+    static const bool	value = true;
+
+    static const T	*address(const T *it)
+    {
+        return (it);
+    }
+};
+
+template <class T>
+struct is_contiguous_iterator<ft::random_access_iterator<T> >
+{
+    typedef ft::random_access_iterator<T>   type;
+    typedef T                               element_type;
+
+    static const bool	value = true;
+
+    static const T	*address(const ft::random_access_iterator<T> &it)
+    {
+        return (it.base());
+    }
+};
+
+template <class T>
+struct is_contiguous_iterator<ft::random_access_iterator<const T> >
+{
+    typedef ft::random_access_iterator<const T> type;
+    typedef T                                   element_type;
+
+    static const bool	value = true;
+
+    static const T	*address(const ft::random_access_iterator<const T> &it)
+    {
+        return (it.base());
+    }
+};
+
+};
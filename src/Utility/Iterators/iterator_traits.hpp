@@ -18,6 +18,9 @@
 
 # pragma once
 
+# include <cstddef>
+# include <iterator>
+
 namespace ft
 {
 
@@ -32,4 +35,26 @@ struct iterator_traits {
 	typedef typename iterator::reference			reference;
 };
 
+template <class T>
+struct iterator_traits<T*> {
+
+	/* ============================== MEMBER TYPE ============================== */
+	typedef T										value_type;
+	typedef std::ptrdiff_t							difference_type;
+	typedef std::random_access_iterator_tag			iterator_category;
+	typedef T*										pointer;
+	typedef T&										reference;
+};
+
+template <class T>
+struct iterator_traits<const T*> {
+
+	/* ============================== MEMBER TYPE ============================== */
+	typedef T										value_type;
+	typedef std::ptrdiff_t							difference_type;
+	typedef std::random_access_iterator_tag			iterator_category;
+	typedef const T*								pointer;
+	typedef const T&								reference;
+};
+
 };
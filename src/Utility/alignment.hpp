@@ -0,0 +1,41 @@
+/*
+** Alignment helpers for the allocators carving their blocks out of bigger chunks
+** (pool_allocator.hpp, arena_allocator.hpp):
+** - __FT_ALIGNOF__(T) the alignment of T (the compiler builtin, C++98 doesn't have alignof)
+** - ft::max_align a type with the strictest fundamental alignment, which operator new guarantees
+** - ft::align_up rounds a size up to a multiple of an alignment
+*/
+
+# pragma once
+
+# include <cstddef>
+
+# if defined (__GNUC__) || defined (__clang__)
+#  define __FT_ALIGNOF__(T) __alignof__(T)
+# else
+#  define __FT_ALIGNOF__(T) sizeof(ft::max_align)
+# endif
+
+namespace ft
+{
+
+union max_align
+{
+	long double	ld;
+	long		l;
+	double		d;
+	void		*p;
+	void		(*f)(void);
+};
+
+/*
+** @param n the size to round up
+** @param align the alignment
+** @return the smallest multiple of align that is >= n
+*/
+inline std::size_t	align_up(std::size_t n, std::size_t align)
+{
+	return (((n + align - 1) / align) * align);
+}
+
+};
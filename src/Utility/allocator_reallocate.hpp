@@ -0,0 +1,93 @@
+/*
+** Optional allocator extension: in place reallocation
+** An allocator can provide the member function:
+**
+**     pointer reallocate(pointer p, size_type old_n, size_type new_n);
+**
+** which tries to resize the block p (holding old_n elements) so it can hold new_n elements,
+** preserving the bytes of its first min(old_n, new_n) elements. On success it returns
+** the (possibly moved) block, on failure it returns a null pointer and p is left untouched.
+** Since the elements are never constructed/destroyed by this call, the containers only
+** use it for trivially relocatable types.
+**
+** has_reallocate detects the extension at compile time, and try_reallocate calls it
+** when it's available, otherwise it always fails so the caller falls back to allocate and copy.
+*/
+
+# pragma once
+
+namespace ft
+{
+
+template <class Alloc>
+struct has_reallocate
+{
+	private:
+		typedef char	yes;
+		typedef struct { char c[2]; } no;
+
+		template <
+			class U,
+			typename U::pointer (U::*)(typename U::pointer, typename U::size_type, typename U::size_type)
+			>
+		struct check {};
+
+		template <class U>
+		static yes	test(check<U, &U::reallocate> *);
+
+		template <class U>
+		static no	test(...);
+
+	public:
+		static const bool	value = (sizeof(test<Alloc>(0)) == sizeof(yes));
+};
+
+template <class Alloc, bool = ft::has_reallocate<Alloc>::value>
+struct allocator_reallocate
+{
+	static typename Alloc::pointer call(
+			Alloc &alloc,
+			typename Alloc::pointer p,
+			typename Alloc::size_type old_n,
+			typename Alloc::size_type new_n)
+	{
+		(void)alloc;
+		(void)p;
+		(void)old_n;
+		(void)new_n;
+		return (0);
+	}
+};
+
+template <class Alloc>
+struct allocator_reallocate<Alloc, true>
+{
+	static typename Alloc::pointer call(
+			Alloc &alloc,
+			typename Alloc::pointer p,
+			typename Alloc::size_type old_n,
+			typename Alloc::size_type new_n)
+	{
+		return (alloc.reallocate(p, old_n, new_n));
+	}
+};
+
+/*
+** Try to grow/shrink the block p in place using the allocator extension
+** @param alloc the allocator that allocated p
+** @param p block to resize
+** @param old_n number of elements the block can currently hold
+** @param new_n number of elements the block should be able to hold
+** @return the resized block, or a null pointer if the allocator can't (or doesn't know how to) do it
+*/
+template <class Alloc>
+typename Alloc::pointer try_reallocate(
+		Alloc &alloc,
+		typename Alloc::pointer p,
+		typename Alloc::size_type old_n,
+		typename Alloc::size_type new_n)
+{
+	return (ft::allocator_reallocate<Alloc>::call(alloc, p, old_n, new_n));
+}
+
+};
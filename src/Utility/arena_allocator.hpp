@@ -0,0 +1,282 @@
+/*
+** arena_allocator
+** A monotonic allocator: the memory comes from big chunks owned by an ft::arena, allocating
+** is a pointer bump and deallocating does nothing. The memory is only given back
+** when the arena is released (or destroyed), all at once, in O(number of chunks).
+**
+** ft::arena scratch;
+** {
+**     ft::Map<int, int, std::less<int>, ft::arena_allocator<ft::pair<const int, int> > > m(std::less<int>(), scratch);
+**     ...
+** }   // m doesn't visit its nodes to destroy them, its elements are trivially destructible
+** scratch.release();
+**
+** - the arena must outlive every container using it, and it's not thread safe.
+** - a container with an arena_allocator skips the per node teardown on clear()/destruction
+**   when its elements are trivially destructible (see is_monotonic_allocator.hpp),
+**   the freed memory is reused only once the arena is released.
+*/
+
+# pragma once
+
+# include <cstddef>
+# include <new>
+# include <limits>
+# include "./move.hpp"
+# include "./alignment.hpp"
+# include "./is_monotonic_allocator.hpp"
+
+/* size of the first chunk of an arena, the next ones double up to __ARENA_MAX_CHUNK_SIZE__ */
+# define __ARENA_FIRST_CHUNK_SIZE__ 4096
+# define __ARENA_MAX_CHUNK_SIZE__ (1024 * 1024)
+
+namespace ft
+{
+
+class arena
+{
+	/* ============================== MEMBER TYPE ============================== */
+	private:
+		struct chunk
+		{
+			chunk	*next;
+		};
+
+	/* ============================== MEMBER ATTRIBUTES ============================== */
+	private:
+		chunk		*_chunks;
+		char		*_cur;
+		char		*_end;
+		std::size_t	_next_size;
+
+	/* ============================== CONSTRUCTORS/DESTRUCTOR ============================== */
+	public:
+		/*
+		** @param chunk_size size of the first chunk, nothing is allocated before the first allocation
+		*/
+		explicit arena(std::size_t chunk_size = __ARENA_FIRST_CHUNK_SIZE__)
+		: _chunks(0), _cur(0), _end(0), _next_size(chunk_size)
+		{
+		}
+
+		~arena()
+		{
+			this->release();
+		}
+
+	private:
+		arena(const arena &);
+		arena &operator=(const arena &);
+
+	/* ============================== MEMBER FUNCTIONS ============================== */
+	public:
+		/*
+		** Carve a block out of the current chunk, a new chunk is allocated when it's full
+		** @param bytes size of the block
+		** @param align alignment of the block
+		** @return the block
+		*/
+		void	*allocate(std::size_t bytes, std::size_t align)
+		{
+			char	*block;
+
+			block = this->_align(this->_cur, align);
+			if (!this->_cur || bytes > static_cast<std::size_t>(this->_end - block))
+			{
+				this->_grow(bytes + align);
+				block = this->_align(this->_cur, align);
+			}
+			this->_cur = block + bytes;
+			return (block);
+		}
+
+		/*
+		** Give all the chunks back to the system, every block allocated so far is invalidated
+		** @param void void
+		** @return void
+		*/
+		void	release(void)
+		{
+			chunk	*next;
+
+			while (this->_chunks)
+			{
+				next = this->_chunks->next;
+				::operator delete(static_cast<void *>(this->_chunks));
+				this->_chunks = next;
+			}
+			this->_cur = 0;
+			this->_end = 0;
+		}
+
+	private:
+		char	*_align(char *p, std::size_t align) const
+		{
+			return (reinterpret_cast<char *>(ft::align_up(reinterpret_cast<std::size_t>(p), align)));
+		}
+
+		/*
+		** Allocate a new chunk big enough for min_bytes
+		*/
+		void	_grow(std::size_t min_bytes)
+		{
+			std::size_t	header;
+			std::size_t	size;
+			chunk		*new_chunk;
+
+			header = ft::align_up(sizeof(chunk), __FT_ALIGNOF__(ft::max_align));
+			size = this->_next_size;
+			if (size < header + min_bytes)
+				size = header + min_bytes;
+			new_chunk = static_cast<chunk *>(::operator new(size));
+			new_chunk->next = this->_chunks;
+			this->_chunks = new_chunk;
+			this->_cur = reinterpret_cast<char *>(new_chunk) + header;
+			this->_end = reinterpret_cast<char *>(new_chunk) + size;
+			if (this->_next_size < __ARENA_MAX_CHUNK_SIZE__)
+				this->_next_size *= 2;
+		}
+};
+
+template <class T>
+class arena_allocator
+{
+	/* ============================== MEMBER TYPE ============================== */
+	public:
+		typedef T					value_type;
+		typedef T*					pointer;
+		typedef const T*			const_pointer;
+		typedef T&					reference;
+		typedef const T&			const_reference;
+		typedef std::size_t			size_type;
+		typedef std::ptrdiff_t		difference_type;
+
+		template <class U>
+		struct rebind
+		{
+			typedef arena_allocator<U>	other;
+		};
+
+	template <class U>
+	friend class arena_allocator;
+
+	/* ============================== MEMBER ATTRIBUTES ============================== */
+	private:
+		ft::arena	*_arena;
+
+	/* ============================== CONSTRUCTORS/DESTRUCTOR ============================== */
+	public:
+		/*
+		** there's no default constructor, the allocator has to know its arena
+		** @param a the arena the memory comes from
+		*/
+		arena_allocator(ft::arena &a) throw()
+		: _arena(&a)
+		{
+		}
+
+		arena_allocator(const arena_allocator &x) throw()
+		: _arena(x._arena)
+		{
+		}
+
+		/*
+		** a rebound allocator uses the same arena
+		*/
+		template <class U>
+		arena_allocator(const arena_allocator<U> &x) throw()
+		: _arena(x._arena)
+		{
+		}
+
+		~arena_allocator() throw()
+		{
+		}
+
+		arena_allocator &operator=(const arena_allocator &x) throw()
+		{
+			this->_arena = x._arena;
+			return (*this);
+		}
+
+	/* ============================== MEMBER FUNCTIONS ============================== */
+	public:
+		pointer address(reference x) const
+		{
+			return (&x);
+		}
+
+		const_pointer address(const_reference x) const
+		{
+			return (&x);
+		}
+
+		/*
+		** Allocate storage for n elements from the arena
+		** @param n number of elements
+		** @param hint unused
+		** @return a pointer to the first element of the block
+		*/
+		pointer allocate(size_type n, const void *hint = 0)
+		{
+			(void)hint;
+			if (n > this->max_size())
+				throw std::bad_alloc();
+			return (static_cast<pointer>(this->_arena->allocate(n * sizeof(value_type), __FT_ALIGNOF__(T))));
+		}
+
+		/*
+		** the memory is reclaimed when the arena is released
+		*/
+		void deallocate(pointer, size_type)
+		{
+		}
+
+		size_type max_size() const throw()
+		{
+			return (std::numeric_limits<size_type>::max() / sizeof(value_type));
+		}
+
+# if __FT_CXX11__
+		template <class U, class... Args>
+		void construct(U *p, Args&&... args)
+		{
+			new (static_cast<void *>(p)) U(std::forward<Args>(args)...);
+		}
+# else
+		void construct(pointer p, const_reference val)
+		{
+			new (static_cast<void *>(p)) value_type(val);
+		}
+# endif
+
+		void destroy(pointer p)
+		{
+			p->~value_type();
+		}
+
+		ft::arena	*resource(void) const
+		{
+			return (this->_arena);
+		}
+};
+
+template <class T>
+struct is_monotonic_allocator<arena_allocator<T> >
+{
+	static const bool	value = true;
+};
+
+template <class T, class U>
+bool operator==(const arena_allocator<T> &lhs, const arena_allocator<U> &rhs)
+{
+	return (lhs.resource() == rhs.resource());
+}
+
+template <class T, class U>
+bool operator!=(const arena_allocator<T> &lhs, const arena_allocator<U> &rhs)
+{
+	return (!(lhs == rhs));
+}
+
+};
@@ -6,10 +6,19 @@
 # pragma once
 
 # include "./utility.hpp"
+# include "./three_way_compare.hpp"
+# include "./default_map_allocator.hpp"
+# include "./avl_augmentation.hpp"
+# include "./is_monotonic_allocator.hpp"
+# include "./is_trivially_destructible.hpp"
 # include <algorithm>
+# include <new>
 # include <functional>
 # include <iostream>
 
+/* ranges longer than this are erased by split/join instead of node by node */
+# define __AVL_SPLIT_THRESHOLD__ 64
+
 namespace ft
 {
 
@@ -17,7 +26,8 @@ namespace ft
 		class Key,
         class T,
         class Compare = std::less<Key>,
-        class Alloc = std::allocator<pair<const Key,T> >
+        class Alloc = typename ft::default_map_allocator<pair<const Key,T> >::type,
+        class Augment = ft::no_augmentation
         >
 	class AVL
 	{
@@ -28,10 +38,15 @@ namespace ft
 			typedef typename ft::pair<const key_type, mapped_type>	value_type;
 			typedef size_t											size_type;
 			typedef Alloc											allocator_type;
+			typedef Augment											augmentation_type;
+			typedef typename ft::augmentation_result<Augment>::type	aggregate_type;
 
 		/* ============================== MEMBER CLASS ============================== */
 		public:
-			struct node
+			/*
+			** the augmentation is a base class, so it takes no room when it's empty (see avl_augmentation.hpp)
+			*/
+			struct node : public Augment
 			{
 				/* =============== MEMBER TYPE =============== */
 				/*
@@ -45,11 +60,15 @@ namespace ft
 				node													*parent;
 				node													*left;
 				node													*right;
-				Compare													_compare;
-
-				value_type												*value;
 				size_type												height;
 
+				/*
+				** the element is stored inside the node (a single allocation per element),
+				** it's constructed/destroyed by the tree with its allocator,
+				** and never constructed for the root_parent sentinel
+				*/
+				value_type												value;
+
 				/* =============== MEMBER FUNCTIONS =============== */
 				/*
 				** Initialize the object
@@ -62,7 +81,6 @@ namespace ft
 					this->right = NULL;
 					this->parent = NULL;
 					this->height = 0;
-					this->value = NULL;
 				}
 
 				/*
@@ -70,9 +88,9 @@ namespace ft
 				** @param void void
 				** @return return the key of the current node
 				*/
-				key_type get_key() const
+				const key_type &get_key() const
 				{
-					return (this->value->first);
+					return (this->value.first);
 				}
 
 				/*
@@ -82,41 +100,7 @@ namespace ft
 				*/
 				mapped_type &get_value()
 				{
-					return (this->value->second);
-				}
-
-				/*
-				** compare 2 keys and return if they are equal
-				** @param k the first key
-				** @return true if they are the same key, otherwise false.
-				*/
-				bool is_equal(key_type k)
-				{
-					/*
-					** Two keys are considered equivalent if the container's comparison object returns false reflexively
-					** (i.e., no matter the order in which the elements are passed as arguments).
-					*/
-					return (this->_compare(this->get_key(), k) == this->_compare(k, this->get_key()));
-				}
-
-				/*
-				** compare 2 keys and return if they met the condition bellow
-				** @param k element key
-				** @return true if they met the condition, otherwise false.
-				*/
-				bool is_lower_bound(key_type k)
-				{
-					return ((this->_compare(this->get_key(), k)) == false);
-				}
-
-				/*
-				** compare 2 keys and return if they met the condition bellow
-				** @param k element key
-				** @return true if they met the condition, otherwise false.
-				*/
-				bool is_upper_bound(key_type k)
-				{
-					return (this->_compare(k, this->get_key()) == true);
+					return (this->value.second);
 				}
 
 				/*
@@ -142,9 +126,9 @@ namespace ft
 					new_root->parent = this->parent;
 					this->parent = new_root;
 
-
-					this->right->update_height();
-					this->left->update_height();
+					/*
+					** only the two rotated nodes have new children, this is below new_root now
+					*/
 					this->update_height();
 					new_root->update_height();
 
@@ -170,8 +154,6 @@ namespace ft
 					new_root->parent = this->parent;
 					this->parent = new_root;
 
-					this->right->update_height();
-					this->left->update_height();
 					this->update_height();
 					new_root->update_height();
 
@@ -197,6 +179,7 @@ namespace ft
 						height = std::max(root->right->height, height);
 
 					root->height = height + 1;
+					root->augment(root->value, static_cast<const Augment *>(root->left), static_cast<const Augment *>(root->right));
 				}
 
 				/*
@@ -216,8 +199,8 @@ namespace ft
 				*/
 				node *minimum_node(node *root)
 				{
-					if (root && root->left)
-						return (root->left->minimum_node());
+					while (root && root->left)
+						root = root->left;
 					return (root);
 				}
 
@@ -238,8 +221,8 @@ namespace ft
 				*/
 				node *maximum_node(node *root)
 				{
-					if (root && root->right)
-						return (root->right->maximum_node());
+					while (root && root->right)
+						root = root->right;
 					return (root);
 				}
 
@@ -253,9 +236,9 @@ namespace ft
 					return (this->maximum_node(this));
 				}
 
-				value_type &operator*() const
+				value_type &operator*()
 				{
-					return (*(this->value));
+					return (this->value);
 				}
 
 				node	*operator++()
@@ -266,7 +249,11 @@ namespace ft
 					if (cur->right)
 						return (cur->right->minimum_node());
 
-					while (cur->parent && cur->parent->right == cur)
+					/*
+					** the root is the left child of root_parent, whose right child is the cached rightmost node
+					** (see root_parent), so the walk stops on a left link rather than going on along right ones
+					*/
+					while (cur->parent && cur->parent->left != cur)
 						cur = cur->parent;
 					return (cur->parent);
 				}
@@ -288,15 +275,32 @@ namespace ft
 		public:
 			/*
 			** default constructor
-			** @param void
+			** @param comp comparison object, the only one of the tree (the nodes don't hold a copy)
+			** @param alloc allocator object, the nodes come from its rebound copy
 			** @return void
 			*/
-			AVL(void)
+			explicit AVL(const Compare &comp = Compare(), const allocator_type &alloc = allocator_type())
+			: _alloc(alloc), _alloc_node(alloc), _compare(comp)
 			{
+				this->root = NULL;
 				this->root_parent = this->_alloc_node.allocate(1);
 				this->root_parent->init();
 				this->root_parent->left = this->root;
+			}
+
+			/*
+			** copy constructor, the copy has the same shape as x (see clone_tree)
+			** @param x the tree to copy
+			** @return void
+			*/
+			AVL(const AVL &x)
+			: _alloc(x._alloc), _alloc_node(x._alloc_node), _compare(x._compare)
+			{
 				this->root = NULL;
+				this->root_parent = this->_alloc_node.allocate(1);
+				this->root_parent->init();
+				this->root_parent->left = this->root;
+				this->clone_tree(x.root);
 			}
 
 			~AVL()
@@ -305,20 +309,60 @@ namespace ft
 
 		/* ============================== MEMBER FUNCTION ============================== */
 		public:
+			/*
+			** compare the key of a node with k and return if they are equal
+			** @param root the node
+			** @param k the key
+			** @return true if they are the same key, otherwise false.
+			*/
+			bool is_equal(const node *root, const key_type &k) const
+			{
+				/*
+				** Two keys are considered equivalent if the container's comparison object returns false reflexively
+				** (i.e., no matter the order in which the elements are passed as arguments).
+				*/
+				return (this->_compare(root->get_key(), k) == this->_compare(k, root->get_key()));
+			}
+
+			/*
+			** check if the key of a node is not less than k
+			** @param root the node
+			** @param k element key
+			** @return true if they met the condition, otherwise false.
+			*/
+			bool is_lower_bound(const node *root, const key_type &k) const
+			{
+				return ((this->_compare(root->get_key(), k)) == false);
+			}
+
+			/*
+			** check if the key of a node is greater than k
+			** @param root the node
+			** @param k element key
+			** @return true if they met the condition, otherwise false.
+			*/
+			bool is_upper_bound(const node *root, const key_type &k) const
+			{
+				return (this->_compare(k, root->get_key()) == true);
+			}
+
 			/*
 			** Create a new node
 			** @param value the value that will inside the node
 			** @return the AVL object after being created
 			*/
-			node *create_node(value_type const value, node *parent = NULL)
+			node *create_node(value_type const &value, node *parent = NULL)
 			{
 				node *root;
 
 				root = this->_alloc_node.allocate(1);
+				/*
+				** like the value, the augmentation data of the node is constructed in place
+				*/
+				new (static_cast<void *>(static_cast<Augment *>(root))) Augment();
 				root->init();
-				root->value = this->_alloc.allocate(1);
-				this->_alloc.construct(root->value, value);
-				root->height = 1;
+				this->_alloc.construct(&root->value, value);
+				root->update_height();
 				root->parent = parent;
 				return (root);
 			}
@@ -345,7 +389,11 @@ namespace ft
 					** LEFT LEFT CASE, Since the left key of the root is bigger than the key,
 					** then the new element will be inserted in the left as well
 					*/
-					if (this->get_balance(root->left) > 0)
+					/*
+					** after a deletion, the left child may be balanced as well,
+					** a single rotation is still enough in that case
+					*/
+					if (this->get_balance(root->left) >= 0)
 						root = root->right_rotation();
 					else
 					{
@@ -361,7 +409,7 @@ namespace ft
 					/*
 					** RIGHT RIGHT CASE, Read the comment for the LEFT LEFT CASE and reverse it to understand this block
 					*/
-					if (this->get_balance(root->right) < 0)
+					if (this->get_balance(root->right) <= 0)
 						root = root->left_rotation();
 					/*
 					** RIGHT LEFT CASE
@@ -395,35 +443,113 @@ namespace ft
 			** @param value value to be inserted in the tree
 			** @return the new root after inserting the new value
 			*/
-			node *insert(value_type const value)
+			node *insert(value_type const &value)
 			{
-				this->root = this->insert(this->root, this->root_parent, value);
-				this->root_parent->left = this->root;
-
+				this->insert_unique(value);
 				return (this->root);
 			}
 
 			/*
-			** Insert the value in the tree
-			** @param root a tree pointing to the root object
-			** @param parent parent of the root
+			** Insert the value in the tree, unless its key is already there
+			** The tree is walked down once, the new leaf is attached to the last visited node,
+			** then the heights are fixed on the way back up (see _retrace_insert).
+			** Each level costs a single comparison (see search), the equality is checked once at the end.
 			** @param value value to be inserted in the tree
-			** @return the new root after inserting the new value
+			** @return a pair with the node holding the key, and true if it has been created by this call
 			*/
-			node *insert(node *root, node *parent, value_type const value)
+			ft::pair<node *, bool> insert_unique(value_type const &value)
 			{
-				if (!root)
-					return (this->create_node(value, parent));
-				if (root->is_equal(value.first))
-					return (root);
-				else if (this->_compare(root->value->first, value.first))
-					root->right = this->insert(root->right, root, value);
-				else
-					root->left = this->insert(root->left, root, value);
+				node	*parent;
+				node	*cur;
+				node	*candidate;
+				bool	to_the_left;
+				int		cmp;
+
+				parent = this->root_parent;
+				cur = this->root;
+				candidate = NULL;
+				to_the_left = true;
+				while (cur)
+				{
+					parent = cur;
+					if (ft::has_three_way<Compare, key_type>::value)
+					{
+						cmp = ft::three_way(this->_compare, value.first, cur->get_key());
+						if (!cmp)
+							return (ft::pair<node *, bool>(cur, false));
+						to_the_left = (cmp < 0);
+					}
+					else
+					{
+						to_the_left = !this->_compare(cur->get_key(), value.first);
+						if (to_the_left)
+							candidate = cur;
+					}
+					cur = to_the_left ? cur->left : cur->right;
+				}
+				/*
+				** candidate is the first node whose key is not less than the new one,
+				** it holds the same key unless the new key is less than its key
+				*/
+				if (candidate && !this->_compare(value.first, candidate->get_key()))
+					return (ft::pair<node *, bool>(candidate, false));
+				/*
+				** when the tree is empty, parent is root_parent and the new node becomes its left child
+				*/
+				return (this->_attach(value, parent, to_the_left));
+			}
 
-				root->update_height();
-				root = this->balance_tree(root);
-				return (root);
+			/*
+			** Insert a new value next to a hint, when the hint is right:
+			** the key must go between the hint and its predecessor (or after the last element if the hint is the end),
+			** which is checked with one or two comparisons against these neighbours. The new node is then
+			** attached to whichever of them has a free child on the right side, and the heights are fixed upward.
+			** For in-order appends (hint = end), the last element is cached (see root_parent)
+			** and the retracing is amortized O(1).
+			** When the hint is wrong, it falls back to insert_unique.
+			** @param hint node before which the value should go, root_parent (or NULL for an empty tree) means the end
+			** @param value value to be inserted in the tree
+			** @return a pair with the node holding the key, and true if it has been created by this call
+			*/
+			ft::pair<node *, bool> insert_hint(node *hint, const value_type &value)
+			{
+				node	*prev;
+
+				if (!this->root)
+					return (this->insert_unique(value));
+				if (!hint || hint == this->root_parent)
+				{
+					prev = this->root_parent->right;
+					if (this->_compare(prev->get_key(), value.first))
+						return (this->_attach(value, prev, false));
+					return (this->insert_unique(value));
+				}
+				if (!this->_compare(value.first, hint->get_key()))
+				{
+					/*
+					** the key is equivalent to the hint's one, or it goes after it
+					*/
+					if (!this->_compare(hint->get_key(), value.first))
+						return (ft::pair<node *, bool>(hint, false));
+					return (this->insert_unique(value));
+				}
+				if (!hint->left)
+				{
+					/*
+					** the predecessor is an ancestor, there's none (NULL) when the hint is the first element
+					*/
+					prev = hint->operator--();
+					if (!prev || this->_compare(prev->get_key(), value.first))
+						return (this->_attach(value, hint, true));
+					return (this->insert_unique(value));
+				}
+				/*
+				** the predecessor is the maximum of the left subtree, its right child is free
+				*/
+				prev = hint->left->maximum_node();
+				if (this->_compare(prev->get_key(), value.first))
+					return (this->_attach(value, prev, false));
+				return (this->insert_unique(value));
 			}
 
 			/*
@@ -433,9 +559,8 @@ namespace ft
 			*/
 			node *deallocate_node(node *root)
 			{
-				this->_alloc.destroy(root->value);
-				this->_alloc.deallocate(root->value, 1);
-				this->_alloc_node.destroy(root);
+				this->_alloc.destroy(&root->value);
+				static_cast<Augment *>(root)->~Augment();
 				this->_alloc_node.deallocate(root, 1);
 				root = NULL;
 
@@ -447,82 +572,254 @@ namespace ft
 			** @param key targeted key
 			** @return returning the tree after deleting the targeted key
 			*/
-			node *delete_node(key_type key)
+			node *delete_node(key_type const &key)
 			{
-				this->root = this->delete_node(this->root, key);
-				this->root_parent->left = this->root;
+				node *target;
 
+				target = this->search(key);
+				if (target)
+					this->delete_node(target);
 				return (this->root);
 			}
 
 			/*
-			** Delete a noce
-			** @param root targeted tree
-			** @param key targeted key
-			** @return returning the tree after deleting the targeted key
+			** Delete a node of the tree
+			** The node is unlinked by relinking pointers only, the values never move:
+			** a node with two children is replaced by its successor (the minimum of its right subtree,
+			** which has no left child), that takes its place, its children and its height.
+			** Only the deleted node is invalidated, the nodes (and the iterators) of the other elements stay valid.
+			** The heights are then fixed on the way back up (see _retrace_erase).
+			** @param target node to delete
+			** @return returning the tree after deleting the node
 			*/
-			node *delete_node(node *root, key_type key)
+			node *delete_node(node *target)
 			{
-				if (!root)
-					return (root);
-				
+				node *child;
+				node *parent;
+				node *successor;
+
 				/*
-				** Targeted key has been found
-				** Two keys are considered equivalent if the container's comparison object returns false reflexively
-				** (i.e., no matter the order in which the elements are passed as arguments).
+				** the rightmost node has no right child, its predecessor becomes the rightmost one
 				*/
-				if (root->is_equal(key))
+				if (target == this->root_parent->right)
+					this->root_parent->right = target->operator--();
+				if (target->left && target->right)
 				{
-					
-					node *tmp;
+					successor = target->right->minimum_node();
+					if (successor == target->right)
+						parent = successor;
+					else
+					{
+						/*
+						** the successor leaves its place to its right child, then adopts the right subtree of target
+						*/
+						parent = successor->parent;
+						parent->left = successor->right;
+						if (successor->right)
+							successor->right->parent = parent;
+						successor->right = target->right;
+						successor->right->parent = successor;
+					}
+					successor->left = target->left;
+					successor->left->parent = successor;
+					successor->parent = target->parent;
+					successor->height = target->height;
+					this->_replace_child(target->parent, target, successor);
+				}
+				else
+				{
+					child = (target->left) ? target->left : target->right;
+					parent = target->parent;
+					if (child)
+						child->parent = parent;
+					this->_replace_child(parent, target, child);
+				}
+				this->deallocate_node(target);
+				this->_retrace_erase(parent);
+				this->root = this->root_parent->left;
+				return (this->root);
+			}
 
-					tmp = NULL;
-					if (root->right == NULL || root->left == NULL)
+			/*
+			** Delete the nodes of the range [first, last)
+			** A short range is deleted node by node, which doesn't compare any key.
+			** A longer one is cut out of the tree: the tree is split around first and last (O(log n) each, see _split),
+			** the middle part is destroyed in a single walk (O(k)), and the two remaining parts are joined
+			** back with last as their root (O(log n), see _join): O(k + log n) overall.
+			** Only the deleted nodes are invalidated.
+			** @param first first node to delete
+			** @param last node following the last one to delete, root_parent for the end of the tree
+			** @return number of deleted nodes
+			*/
+			size_type delete_range(node *first, node *last)
+			{
+				node		*cur;
+				node		*left;
+				node		*middle;
+				node		*right;
+				node		*rest;
+				node		*pivot;
+				size_type	count;
+
+				for (cur = first, count = 0; cur != last && count < __AVL_SPLIT_THRESHOLD__; count++)
+					cur = cur->operator++();
+				if (cur == last)
+				{
+					while (first != last)
 					{
-						tmp = (root->left) ? root->left : root->right;
-						if (tmp == NULL)
-						{
-							tmp = root;
-							root = NULL;
-						}
-						else
-						{
-							root->right = tmp->right;
-							root->left = tmp->left;
-							this->_alloc.destroy(root->value);
-							this->_alloc.construct(root->value, *(tmp->value));
-						}
-						this->deallocate_node(tmp);
+						cur = first->operator++();
+						this->delete_node(first);
+						first = cur;
 					}
+					return (count);
+				}
+				this->_split(this->root, first->get_key(), left, pivot, right);
+				if (last == this->root_parent)
+				{
+					middle = right;
+					this->root = left;
+				}
+				else
+				{
+					this->_split(right, last->get_key(), middle, pivot, rest);
+					this->root = this->_join(left, last, rest);
+				}
+				if (this->root)
+					this->root->parent = this->root_parent;
+				this->root_parent->left = this->root;
+				this->_reset_rightmost();
+				/*
+				** the parent pointer of a part's root is stale after a split
+				*/
+				if (middle)
+					middle->parent = NULL;
+				count = 1 + this->_destroy_subtree(middle);
+				this->deallocate_node(first);
+				return (count);
+			}
+
+			/*
+			** Get the k-th node in the order of the keys, in O(log n)
+			** the tree must be augmented with ft::subtree_size
+			** @param k position of the node, starting at 0
+			** @return the node, NULL if k is out of range
+			*/
+			node *select(size_type k) const
+			{
+				node		*cur;
+				size_type	left_size;
+
+				cur = this->root;
+				while (cur)
+				{
+					left_size = _size_of(cur->left);
+					if (k == left_size)
+						return (cur);
+					if (k < left_size)
+						cur = cur->left;
 					else
 					{
-						tmp = root->right->minimum_node();
+						k -= left_size + 1;
+						cur = cur->right;
+					}
+				}
+				return (NULL);
+			}
+
+			/*
+			** Count the keys going before key, in O(log n) with a single comparison per level
+			** the tree must be augmented with ft::subtree_size
+			** @param key the key to rank
+			** @return the number of keys going before key, which is the position of key if it's in the tree
+			*/
+			size_type rank(const key_type &key) const
+			{
+				node		*cur;
+				size_type	count;
 
-						this->_alloc.destroy(root->value);
-						this->_alloc.construct(root->value, *(tmp->value));
-						root->right = this->delete_node(root->right, tmp->get_key());
+				cur = this->root;
+				count = 0;
+				while (cur)
+				{
+					if (this->_compare(cur->get_key(), key))
+					{
+						count += _size_of(cur->left) + 1;
+						cur = cur->right;
 					}
+					else
+						cur = cur->left;
 				}
-				/*
-				** Search on the right
-				*/
-				else if (this->_compare(root->get_key(), key))
-					root->right = this->delete_node(root->right, key);
-				/*
-				** Search on the left
-				*/
-				else
-					root->left = this->delete_node(root->left, key);
+				return (count);
+			}
 
-				/*
-				** if the tree has only one node, which means no left or right,
-				** then return it
-				*/
-				if (root == NULL)
-					return (root);
-				root->update_height();
-				root = this->balance_tree(root);
-				return (root);
+			/*
+			** Aggregate the elements whose key is in [lo, hi), in O(log n)
+			** the tree must be augmented with ft::subtree_aggregate:
+			** the descent stops at the first node inside the range, then the range is made of
+			** the part of its left subtree that doesn't go before lo, the node itself,
+			** and the part of its right subtree that goes before hi.
+			** On each side, a node inside the range brings its whole inner subtree (its aggregate) at once.
+			** @param lo lower bound, included
+			** @param hi upper bound, excluded
+			** @return the aggregate, in the order of the keys, the identity of the monoid if the range is empty
+			*/
+			aggregate_type aggregate(const key_type &lo, const key_type &hi) const
+			{
+				typedef typename Augment::monoid_type	monoid;
+				node									*split;
+				node									*cur;
+				aggregate_type							result;
+
+				split = this->root;
+				while (split)
+				{
+					if (this->_compare(split->get_key(), lo))
+						split = split->right;
+					else if (!this->_compare(split->get_key(), hi))
+						split = split->left;
+					else
+						break ;
+				}
+				if (!split)
+					return (monoid::identity());
+				result = monoid::lift(split->value);
+				for (cur = split->left; cur;)
+				{
+					if (this->_compare(cur->get_key(), lo))
+						cur = cur->right;
+					else
+					{
+						if (cur->right)
+							result = monoid::combine(cur->right->aggregate, result);
+						result = monoid::combine(monoid::lift(cur->value), result);
+						cur = cur->left;
+					}
+				}
+				for (cur = split->right; cur;)
+				{
+					if (this->_compare(cur->get_key(), hi))
+					{
+						if (cur->left)
+							result = monoid::combine(result, cur->left->aggregate);
+						result = monoid::combine(result, monoid::lift(cur->value));
+						cur = cur->right;
+					}
+					else
+						cur = cur->left;
+				}
+				return (result);
+			}
+
+			/*
+			** Recompute the augmentation of a node and of all its ancestors, in O(log n)
+			** the augmentation of a node is computed when the tree is modified, a value changed
+			** in place afterward (the mapped value of a Map) has to be refreshed by hand
+			** @param target the node whose value changed
+			** @return void
+			*/
+			void refresh(node *target)
+			{
+				this->_propagate(target);
 			}
 
 			/*
@@ -530,55 +827,66 @@ namespace ft
 			** @param key the needle
 			** @return return the node that contains that key, otherwise NULL
 			*/
-			node *search(key_type key) const
+			node *search(key_type const &key) const
 			{
 				return (this->search(this->root, key));
 			}
 
 			/*
 			** search for a specific key inside the tree
+			** The descent is the lower bound one, with a single comparison per level,
+			** and the equality is checked once at the end.
+			** If the comparison object is three-way (see three_way_compare.hpp), that single
+			** comparison tells the equality as well, and the search stops as soon as the key is found.
 			** @param root subtree to search at
 			** @param key the needle
 			** @return return the node that contains that key, otherwise NULL
 			*/
-			node *search(node *root, key_type key) const
+			node *search(node *root, key_type const &key) const
 			{
-				if (root == NULL)
-					return (root);
-				else if (root->is_equal(key))
-					return (root);
-				else if (this->_compare(root->get_key(), key))
-					return (this->search(root->right, key));
-				else
-					return (this->search(root->left, key));
+				node	*candidate;
+				int		cmp;
+
+				if (ft::has_three_way<Compare, key_type>::value)
+				{
+					while (root)
+					{
+						cmp = ft::three_way(this->_compare, key, root->get_key());
+						if (!cmp)
+							return (root);
+						root = (cmp < 0) ? root->left : root->right;
+					}
+					return (NULL);
+				}
+				candidate = this->lower_bound(root, key);
+				if (candidate && !this->_compare(key, candidate->get_key()))
+					return (candidate);
+				return (NULL);
 			}
 
 			/*
 			** search for a the lower bound inside the tree
+			** (the first node whose key is not less than key)
 			** @param root subtree to search at
 			** @param key the needle
 			** @return return the lower bound, otherwise NULL
 			*/
 			node *lower_bound(node *root, key_type const &key) const
 			{
-				node *tmp;
+				node *bound;
 
-				tmp = NULL;
-				if (!root || root->is_equal(key))
-					return (root);
-				if (this->_compare(key, root->get_key()))
-					tmp = this->lower_bound(root->left, key);
-				else
-					tmp = this->lower_bound(root->right, key);
-				/*
-				** return the tmp value, in case its key is equal to the key variable,
-				** or its key is less than the root key
-				*/
-				if (tmp && (tmp->is_equal(key) || this->_compare(tmp->get_key(), root->get_key())))
-					return (tmp);
-				else if (root->is_lower_bound(key))
-					return (root);
-				return (tmp);
+				bound = NULL;
+				while (root)
+				{
+					if (this->is_lower_bound(root, key))
+					{
+						bound = root;
+						root = root->left;
+					}
+					else
+						root = root->right;
+				}
+				return (bound);
 			}
 
 			/*
@@ -593,30 +901,27 @@ namespace ft
 
 			/*
 			** search for a the upper bound inside the tree
+			** (the first node whose key is greater than key)
 			** @param root subtree to search at
 			** @param key the needle
 			** @return return the upper bound, otherwise NULL
 			*/
 			node *upper_bound(node *root, key_type const &key) const
 			{
-				node *tmp;
+				node *bound;
 
-				tmp = NULL;
-				if (!root)
-					return (root);
-				if (this->_compare(key, root->get_key()))
-					tmp = this->upper_bound(root->left, key);
-				else
-					tmp = this->upper_bound(root->right, key);
-				/*
-				** return the tmp value, in case its key is equal to the key variable,
-				** or its key is less than the root key
-				*/
-				if (tmp && this->_compare(tmp->get_key(), root->get_key()))
-					return (tmp);
-				else if (root->is_upper_bound(key))
-					return (root);
-				return (tmp);
+				bound = NULL;
+				while (root)
+				{
+					if (this->is_upper_bound(root, key))
+					{
+						bound = root;
+						root = root->left;
+					}
+					else
+						root = root->right;
+				}
+				return (bound);
 			}
 
 			/*
@@ -639,16 +944,16 @@ namespace ft
 				if (!tree)
 					return ;
 				std::cout << "LEFT = ";
-				if (tree->left && tree->left->value)
-					std::cout << '(' << tree->left->value->first << ',' << tree->left->value->second << ')';
+				if (tree->left)
+					std::cout << '(' << tree->left->value.first << ',' << tree->left->value.second << ')';
 				else
 					std::cout << "(NULL)";
 				std::cout << "\t|\t";
-				std::cout << '(' << tree->value->first << ',' << tree->value->second << ')';
+				std::cout << '(' << tree->value.first << ',' << tree->value.second << ')';
 				std::cout << "\t|\t";
 				std::cout << "RIGHT = ";
-				if (tree->right && tree->right->value)
-					std::cout << '(' << tree->right->value->first << ',' << tree->right->value->second << ')';
+				if (tree->right)
+					std::cout << '(' << tree->right->value.first << ',' << tree->right->value.second << ')';
 				else
 					std::cout << "(NULL)";
 				std::cout << std::endl;
@@ -658,22 +963,14 @@ namespace ft
 
 			/*
 			** take a node and clear all the subtree
+			** a single post-order walk following the parent pointers:
+			** no recursion, no rebalancing, every node is visited once
 			** @param root the targeted tree/sub tree
-			** @return void
+			** @return NULL, the new value of the link to the subtree
 			*/
 			node *clear(node *root)
 			{
-				if (!root)
-					return (root);
-				if (root->left)
-					root->left = this->clear(root->left);
-				if (root->right)
-					root->right = this->clear(root->right);
-				this->_alloc.destroy(root->value);
-				this->_alloc.deallocate(root->value, 1);
-				this->_alloc_node.destroy(root);
-				this->_alloc_node.deallocate(root, 1);
-
+				this->_destroy_subtree(root);
 				return (NULL);
 			}
 
@@ -684,13 +981,108 @@ namespace ft
 			*/
 			void clear(bool clear_parent = false)
 			{
-				this->root = this->clear(this->root);
+				/*
+				** with a monotonic allocator there's nothing to deallocate,
+				** and nothing to destroy if the elements (and the augmentation) are trivially destructible:
+				** the nodes are simply dropped, their memory goes away with the arena
+				*/
+				if (ft::is_monotonic_allocator<allocator_type>::value && ft::is_trivially_destructible<value_type>::value
+					&& ft::is_trivially_destructible<Augment>::value)
+					this->root = NULL;
+				else
+					this->root = this->clear(this->root);
 
 				this->root_parent->left = this->root;
+				this->root_parent->right = NULL;
 				if (clear_parent)
 					this->_alloc_node.deallocate(this->root_parent, 1);
 			}
 
+			/*
+			** Copy the shape of another tree into this one, which must be empty:
+			** every node of rhs gets its twin at the same place and with the same height,
+			** in a single pre-order walk, so there is no comparison and no rotation: O(n)
+			** @param rhs root of the tree to copy
+			** @return void
+			*/
+			void clone_tree(const node *rhs)
+			{
+				const node	*src;
+				node		*dst;
+
+				if (!rhs)
+					return ;
+				this->root = this->_clone_node(rhs, this->root_parent);
+				this->root_parent->left = this->root;
+				src = rhs;
+				dst = this->root;
+				while (true)
+				{
+					if (src->left && !dst->left)
+					{
+						dst->left = this->_clone_node(src->left, dst);
+						src = src->left;
+						dst = dst->left;
+					}
+					else if (src->right && !dst->right)
+					{
+						dst->right = this->_clone_node(src->right, dst);
+						src = src->right;
+						dst = dst->right;
+					}
+					else if (dst == this->root)
+						break ;
+					else
+					{
+						src = src->parent;
+						dst = dst->parent;
+					}
+				}
+				this->_reset_rightmost();
+			}
+
+			/*
+			** Build the tree, which must be empty, from a range sorted by key without duplicates: O(n)
+			** the nodes are created in order and chained through their right child,
+			** then linked into a perfectly balanced tree (see _link_balanced), there's no rotation.
+			** @param first beginning of the range, on return it points to where the construction stopped
+			** @param last end of the range
+			** @param check if true, the construction stops at the first element whose key
+			** doesn't go after the key of the previous one (one comparison per element),
+			** otherwise the range is trusted to be sorted and unique
+			** @return number of elements inserted
+			*/
+			template <class InputIterator>
+			size_type build_sorted(InputIterator &first, InputIterator last, bool check)
+			{
+				node		*chain;
+				node		*tail;
+				size_type	count;
+
+				chain = NULL;
+				tail = NULL;
+				count = 0;
+				for (; first != last; ++first, ++count)
+				{
+					if (check && tail && !this->_compare(tail->get_key(), (*first).first))
+						break ;
+					if (tail)
+					{
+						tail->right = this->create_node(*first);
+						tail = tail->right;
+					}
+					else
+					{
+						chain = this->create_node(*first);
+						tail = chain;
+					}
+				}
+				this->root = this->_link_balanced(chain, count, this->root_parent);
+				this->root_parent->left = this->root;
+				this->root_parent->right = tail;
+				return (count);
+			}
+
 			/*
 			** take a node and insert all it's alement into the root of the current object
 			** @param node the targeted node to be copied
@@ -704,7 +1096,7 @@ namespace ft
 					this->copy_tree(rhs->right);
 				if (rhs->left)
 					this->copy_tree(rhs->left);
-				this->insert(*(rhs->value));
+				this->insert(rhs->value);
 			}
 
 			/*
@@ -714,43 +1106,360 @@ namespace ft
 			*/
 			void swap (AVL& x)
 			{
-				AVL tmp;
-
-				tmp.root = this->root;
-				tmp.root_parent = this->root_parent;
-				tmp._alloc = this->_alloc;
-				tmp._alloc_node = this->_alloc_node;
-				tmp._compare = this->_compare;
-				
-				this->root = x.root;
-				this->root_parent = x.root_parent;
-				this->_alloc = x._alloc;
-				this->_alloc_node = x._alloc_node;
-				this->_compare = x._compare;
-				
-				x.root = tmp.root;
-				x.root_parent = tmp.root_parent;
-				x._alloc = tmp._alloc;
-				x._alloc_node = tmp._alloc_node;
-				x._compare = tmp._compare;
+				/*
+				** the cached rightmost nodes go with their root_parent
+				*/
+				std::swap(this->root, x.root);
+				std::swap(this->root_parent, x.root_parent);
+				std::swap(this->_alloc, x._alloc);
+				std::swap(this->_alloc_node, x._alloc_node);
+				std::swap(this->_compare, x._compare);
 			}
 
 			AVL& operator= (const AVL& rhs)
 			{
+				if (this == &rhs)
+					return (*this);
+				/*
+				** the allocators are not copied: root_parent and the nodes
+				** to come belong to the ones of this tree (which matters for a pool_allocator)
+				*/
 				this->clear();
-				this->_alloc = rhs._alloc;
-				this->_alloc_node = rhs._alloc_node;
 				this->_compare = rhs._compare;
-				this->copy_tree(rhs.root);
+				this->clone_tree(rhs.root);
 
 				return (*this);
 			}
 
+		/* ============================== HELPER FUNCTIONS ============================== */
+		private:
+			/*
+			** destroy and deallocate every node of a subtree, in a single post-order walk
+			** following the parent pointers (no recursion, no rebalancing).
+			** the link from the parent of root to root is left as is, it's up to the caller to reset it.
+			** @param root the subtree
+			** @return the number of destroyed nodes
+			*/
+			size_type _destroy_subtree(node *root)
+			{
+				node		*stop;
+				node		*parent;
+				size_type	count;
+
+				if (!root)
+					return (0);
+				count = 0;
+				stop = root->parent;
+				while (root != stop)
+				{
+					if (root->left)
+						root = root->left;
+					else if (root->right)
+						root = root->right;
+					else
+					{
+						/*
+						** a leaf: unlink it from its parent, which becomes a leaf once both of its children are gone
+						*/
+						parent = root->parent;
+						if (parent != stop)
+						{
+							if (parent->left == root)
+								parent->left = NULL;
+							else
+								parent->right = NULL;
+						}
+						this->_alloc.destroy(&root->value);
+						static_cast<Augment *>(root)->~Augment();
+						this->_alloc_node.deallocate(root, 1);
+						++count;
+						root = parent;
+					}
+				}
+				return (count);
+			}
+
+			/*
+			** recompute the cached rightmost node after the tree has been rebuilt, O(log n)
+			*/
+			void _reset_rightmost(void)
+			{
+				this->root_parent->right = this->root ? this->root->maximum_node() : NULL;
+			}
+
+			static size_type _height(const node *root)
+			{
+				return (root ? root->height : 0);
+			}
+
+			static size_type _size_of(const node *root)
+			{
+				return (root ? root->size : 0);
+			}
+
+			/*
+			** Join two subtrees and a node: every key of left goes before the key of middle,
+			** which goes before every key of right.
+			** The shortest subtree is hung next to middle along the spine of the tallest one,
+			** at the first node that isn't taller than it by more than one, then the spine is rebalanced
+			** on the way back up: O(difference of heights)
+			** @param left the subtree with the smallest keys, can be NULL
+			** @param middle a node detached from any tree
+			** @param right the subtree with the biggest keys, can be NULL
+			** @return the root of the joined tree, its parent pointer is left to the caller
+			*/
+			node *_join(node *left, node *middle, node *right)
+			{
+				node *child;
+
+				if (_height(left) > _height(right) + 1)
+				{
+					child = this->_join(left->right, middle, right);
+					left->right = child;
+					child->parent = left;
+					left->update_height();
+					return (this->balance_tree(left));
+				}
+				if (_height(right) > _height(left) + 1)
+				{
+					child = this->_join(left, middle, right->left);
+					right->left = child;
+					child->parent = right;
+					right->update_height();
+					return (this->balance_tree(right));
+				}
+				middle->left = left;
+				middle->right = right;
+				if (left)
+					left->parent = middle;
+				if (right)
+					right->parent = middle;
+				middle->update_height();
+				return (middle);
+			}
+
+			/*
+			** Split a subtree around a key: the nodes whose key goes before key, the node with that key (if any),
+			** and the nodes whose key goes after it. Each level of the descent joins the part it leaves behind
+			** to one of the sides (see _join), which adds up to O(log n).
+			** @param root the subtree, its nodes are all moved to one of the three parts
+			** @param key the key to split at
+			** @param left the nodes with the smallest keys
+			** @param middle the node with the key, left untouched if there's none
+			** @param right the nodes with the biggest keys
+			** @return void
+			*/
+			void _split(node *root, const key_type &key, node *&left, node *&middle, node *&right)
+			{
+				node	*sub_left;
+				node	*sub_right;
+				node	*inner;
+				int		cmp;
+
+				if (!root)
+				{
+					left = NULL;
+					right = NULL;
+					return ;
+				}
+				sub_left = root->left;
+				sub_right = root->right;
+				cmp = ft::three_way(this->_compare, key, root->get_key());
+				if (cmp < 0)
+				{
+					this->_split(sub_left, key, left, middle, inner);
+					right = this->_join(inner, root, sub_right);
+				}
+				else if (cmp > 0)
+				{
+					this->_split(sub_right, key, inner, middle, right);
+					left = this->_join(sub_left, root, inner);
+				}
+				else
+				{
+					middle = root;
+					left = sub_left;
+					right = sub_right;
+				}
+			}
+
+			/*
+			** create a node for value as a new leaf under parent, then fix the heights upward
+			** @param value value of the new node
+			** @param parent parent of the new node, its child on that side must be free
+			** @param to_the_left whether the new node is the left or the right child of parent
+			** @return a pair with the new node and true
+			*/
+			ft::pair<node *, bool> _attach(const value_type &value, node *parent, bool to_the_left)
+			{
+				node *new_node;
+
+				new_node = this->create_node(value, parent);
+				if (to_the_left)
+					parent->left = new_node;
+				else
+					parent->right = new_node;
+				/*
+				** rotations don't change the order of the nodes, only a new last node changes the rightmost one
+				*/
+				if (parent == this->root_parent || (!to_the_left && parent == this->root_parent->right))
+					this->root_parent->right = new_node;
+				this->_retrace_insert(parent);
+				this->root = this->root_parent->left;
+				return (ft::pair<node *, bool>(new_node, true));
+			}
+
+			/*
+			** Link the first n nodes of a chain (in order, through their right child) into a perfectly balanced tree:
+			** the middle node is the root, the halves before and after it are its subtrees,
+			** whose sizes differ by at most one, so the AVL invariant holds at every node.
+			** the recursion depth is log2(n)
+			** @param chain the chain, on return it points to the node following the n first ones
+			** @param n number of nodes to link
+			** @param parent parent of the subtree
+			** @return the root of the subtree
+			*/
+			node *_link_balanced(node *&chain, size_type n, node *parent)
+			{
+				node *left;
+				node *middle;
+
+				if (!n)
+					return (NULL);
+				left = this->_link_balanced(chain, n / 2, NULL);
+				middle = chain;
+				chain = chain->right;
+				middle->parent = parent;
+				middle->left = left;
+				if (left)
+					left->parent = middle;
+				middle->right = this->_link_balanced(chain, n - n / 2 - 1, middle);
+				middle->update_height();
+				return (middle);
+			}
+
+			/*
+			** a new node holding a copy of the value of src, at the same height
+			** @param src the node to copy
+			** @param parent parent of the new node
+			** @return the new node, without children
+			*/
+			node *_clone_node(const node *src, node *parent)
+			{
+				node *copy;
+
+				copy = this->create_node(src->value, parent);
+				copy->height = src->height;
+				static_cast<Augment &>(*copy) = static_cast<const Augment &>(*src);
+				return (copy);
+			}
+
+			/*
+			** make new_child take the place of old_child under parent
+			** (parent can be root_parent, whose left child is the root of the tree)
+			** @param parent parent of old_child
+			** @param old_child current child
+			** @param new_child the replacement, can be NULL
+			** @return void
+			*/
+			void _replace_child(node *parent, node *old_child, node *new_child)
+			{
+				if (parent->left == old_child)
+					parent->left = new_child;
+				else
+					parent->right = new_child;
+			}
+
+			/*
+			** rebalance the subtree of root, and link the new subtree root to its parent
+			** @param root node whose balance is 2 or -2
+			** @return the new root of the subtree
+			*/
+			node *_rebalance(node *root)
+			{
+				node *parent;
+				node *new_root;
+
+				parent = root->parent;
+				new_root = this->balance_tree(root);
+				this->_replace_child(parent, root, new_root);
+				return (new_root);
+			}
+
+			/*
+			** fix the heights from node up to the root after an insertion
+			** It stops as soon as a subtree keeps its height, or after the first rotation:
+			** a rotation after an insertion always gives the subtree its height back.
+			** @param cur parent of the inserted node
+			** @return void
+			*/
+			void _retrace_insert(node *cur)
+			{
+				size_type old_height;
+
+				while (cur != this->root_parent)
+				{
+					old_height = cur->height;
+					cur->update_height();
+					if (std::abs(this->get_balance(cur)) == 2)
+					{
+						cur = this->_rebalance(cur);
+						return (this->_propagate(cur->parent));
+					}
+					if (cur->height == old_height)
+						return (this->_propagate(cur->parent));
+					cur = cur->parent;
+				}
+			}
+
+			/*
+			** fix the heights from node up to the root after a deletion
+			** Unlike the insertion, a rotation can shrink the subtree, so the walk goes on
+			** until a subtree keeps its height.
+			** @param cur parent of the unlinked node
+			** @return void
+			*/
+			void _retrace_erase(node *cur)
+			{
+				size_type	old_height;
+				node		*parent;
+
+				while (cur != this->root_parent)
+				{
+					old_height = cur->height;
+					parent = cur->parent;
+					cur->update_height();
+					if (std::abs(this->get_balance(cur)) == 2)
+						cur = this->_rebalance(cur);
+					if (cur->height == old_height)
+						return (this->_propagate(parent));
+					cur = parent;
+				}
+			}
+
+			/*
+			** the retracing stops where the heights don't change anymore,
+			** but the augmentation of the nodes above still has to be updated
+			** @param cur first node to update
+			** @return void
+			*/
+			void _propagate(node *cur)
+			{
+				if (!Augment::enabled)
+					return ;
+				while (cur != this->root_parent)
+				{
+					cur->update_height();
+					cur = cur->parent;
+				}
+			}
+
 		/* ============================== MEMBER ATTRIBUTES ============================== */
 		public:
 			node													*root;
 			/*
 			** this is the last element in the tree, which should be retourned by the end() function in the ::map
+			** its left child is the root, its right child caches the rightmost node (the last element, NULL if empty)
 			*/
 			node													*root_parent;
 		
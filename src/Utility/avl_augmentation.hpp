@@ -0,0 +1,216 @@
+/*
+** AVL augmentations
+** The Augment parameter of ft::AVL (and ft::Map) is a base class of every node of the tree,
+** holding some data about the node's subtree. It provides:
+**
+**     static const bool enabled;
+**     template <class Value>
+**     void augment(const Value &value, const Augment *left, const Augment *right);
+**
+** augment recomputes the data of a node from its value and the data of its children (NULL when missing).
+** The tree calls it whenever a node gets new children or new descendants: with the height,
+** through the rotations, and up to the root after an insertion or a deletion.
+** When enabled is false (no_augmentation), that last walk is skipped, and the
+** empty base class costs nothing in the node.
+*/
+
+# pragma once
+
+# include <cstddef>
+# include <limits>
+
+namespace ft
+{
+
+/*
+** the default: nothing is maintained
+*/
+struct no_augmentation
+{
+	static const bool	enabled = false;
+
+	template <class Value>
+	void augment(const Value &value, const no_augmentation *left, const no_augmentation *right)
+	{
+		(void)value;
+		(void)left;
+		(void)right;
+	}
+};
+
+/*
+** order statistics: the number of nodes of the subtree,
+** which gives the rank of a key and the k-th element in O(log n)
+**
+** ft::Map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::subtree_size> scores;
+** scores.nth(scores.size() / 2);
+*/
+struct subtree_size
+{
+	static const bool	enabled = true;
+
+	std::size_t	size;
+
+	template <class Value>
+	void augment(const Value &value, const subtree_size *left, const subtree_size *right)
+	{
+		(void)value;
+		this->size = 1 + (left ? left->size : 0) + (right ? right->size : 0);
+	}
+};
+
+/*
+** aggregates over key ranges: a monoid (an associative combine with an identity element)
+** folded over every subtree, which gives the aggregate of any range of keys in O(log n).
+** A monoid provides:
+**
+**     typedef ... result_type;
+**     static result_type identity();
+**     static result_type lift(const value_type &value);        // an element of the map
+**     static result_type combine(const result_type &a, const result_type &b);
+**
+** combine must be associative, and it's always called with a going before b in the order of the keys,
+** so it doesn't need to be commutative.
+** The subtree sizes are maintained as well, so nth/rank/count_range keep working.
+** The aggregates are updated when the tree changes. A mapped value must be modified
+** through Map::update or Map::add, which recompute the aggregates above it: a value written
+** in place (operator[], an iterator) leaves them stale until Map::refresh is called on its element.
+**
+** ft::Map<int, long, std::less<int>, std::allocator<ft::pair<const int, long> >,
+**     ft::subtree_aggregate<ft::sum_monoid<long> > > metrics;
+** metrics.aggregate(from, to);
+** metrics.add(key, 10);
+*/
+template <class Monoid>
+struct subtree_aggregate : public subtree_size
+{
+	typedef Monoid							monoid_type;
+	typedef typename Monoid::result_type	result_type;
+
+	static const bool	enabled = true;
+
+	result_type	aggregate;
+
+	template <class Value>
+	void augment(const Value &value, const subtree_aggregate *left, const subtree_aggregate *right)
+	{
+		this->subtree_size::augment(value, left, right);
+		this->aggregate = Monoid::lift(value);
+		if (left)
+			this->aggregate = Monoid::combine(left->aggregate, this->aggregate);
+		if (right)
+			this->aggregate = Monoid::combine(this->aggregate, right->aggregate);
+	}
+};
+
+/*
+** the type of the aggregates of an augmentation, void if it doesn't aggregate anything
+*/
+template <class Augment>
+struct augmentation_result
+{
+	typedef void	type;
+};
+
+template <class Monoid>
+struct augmentation_result<subtree_aggregate<Monoid> >
+{
+	typedef typename Monoid::result_type	type;
+};
+
+/*
+** ready to use monoids, on the mapped values of a Map
+*/
+template <class T>
+struct sum_monoid
+{
+	typedef T	result_type;
+
+	static T identity()
+	{
+		return (T());
+	}
+
+	template <class Value>
+	static T lift(const Value &value)
+	{
+		return (value.second);
+	}
+
+	static T combine(const T &a, const T &b)
+	{
+		return (a + b);
+	}
+};
+
+template <class T>
+struct min_monoid
+{
+	typedef T	result_type;
+
+	static T identity()
+	{
+		return (std::numeric_limits<T>::max());
+	}
+
+	template <class Value>
+	static T lift(const Value &value)
+	{
+		return (value.second);
+	}
+
+	static T combine(const T &a, const T &b)
+	{
+		return (b < a ? b : a);
+	}
+};
+
+template <class T>
+struct max_monoid
+{
+	typedef T	result_type;
+
+	static T identity()
+	{
+		if (std::numeric_limits<T>::is_integer)
+			return (std::numeric_limits<T>::min());
+		return (-std::numeric_limits<T>::max());
+	}
+
+	template <class Value>
+	static T lift(const Value &value)
+	{
+		return (value.second);
+	}
+
+	static T combine(const T &a, const T &b)
+	{
+		return (a < b ? b : a);
+	}
+};
+
+/*
+** the number of elements (the same as count_range, as a monoid)
+*/
+struct count_monoid
+{
+	typedef std::size_t	result_type;
+
+	static std::size_t identity()
+	{
+		return (0);
+	}
+
+	template <class Value>
+	static std::size_t lift(const Value &)
+	{
+		return (1);
+	}
+
+	static std::size_t combine(const std::size_t &a, const std::size_t &b)
+	{
+		return (a + b);
+	}
+};
+
+};
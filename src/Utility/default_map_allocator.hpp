@@ -0,0 +1,29 @@
+/*
+** default_map_allocator
+** The allocator ft::Map and ft::AVL use when none is given:
+** std::allocator, or ft::pool_allocator when __FT_MAP_POOL_ALLOCATOR__ is defined
+** (before including map.hpp, or on the command line: -D__FT_MAP_POOL_ALLOCATOR__).
+*/
+
+# pragma once
+
+# include <memory>
+
+# if defined (__FT_MAP_POOL_ALLOCATOR__)
+#  include "./pool_allocator.hpp"
+# endif
+
+namespace ft
+{
+
+template <class T>
+struct default_map_allocator
+{
+# if defined (__FT_MAP_POOL_ALLOCATOR__)
+	typedef ft::pool_allocator<T>	type;
+# else
+	typedef std::allocator<T>		type;
+# endif
+};
+
+};
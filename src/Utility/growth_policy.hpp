@@ -0,0 +1,141 @@
+/*
+** Vector growth policies
+** A growth policy decides the new capacity of a Vector when it runs out of storage.
+** It's a class with a single static member function:
+**
+**     template <class T>
+**     static std::size_t next_capacity(std::size_t capacity, std::size_t required);
+**
+** where capacity is the current capacity (0 when the old content is thrown away, e.g. assign),
+** required is the minimum number of elements the new storage must hold, and T is the element type
+** (so the policy can reason in bytes). The returned value must be at least required.
+**
+** |--------------------------------|-----------------------------------------------------------|
+** | policy                         | new capacity                                              |
+** |--------------------------------|-----------------------------------------------------------|
+** | growth_double (default)        | capacity * 2                                              |
+** | growth_one_and_half            | capacity * 1.5                                            |
+** | growth_fixed_chunk<N>          | required rounded up to a multiple of N elements           |
+** | growth_page_rounded<Base, P>   | Base, rounded up to a multiple of P bytes (when >= P)     |
+** | growth_size_class<Base>        | Base, rounded up to the next malloc size class            |
+** |--------------------------------|-----------------------------------------------------------|
+**
+** Every geometric policy keeps push_back amortized constant, growth_fixed_chunk doesn't
+** (it's meant for vectors with a known, bounded growth).
+*/
+
+# pragma once
+
+# include <cstddef>
+
+# define __VECTOR_GROWTH_SIZE__ 2
+
+namespace ft
+{
+
+/*
+** return the biggest value between a and b
+*/
+inline std::size_t	_growth_max(std::size_t a, std::size_t b)
+{
+	return ((a > b) ? a : b);
+}
+
+/*
+** round n up to the next multiple of m
+*/
+inline std::size_t	_growth_round_up(std::size_t n, std::size_t m)
+{
+	return (((n + m - 1) / m) * m);
+}
+
+struct growth_double
+{
+	template <class T>
+	static std::size_t next_capacity(std::size_t capacity, std::size_t required)
+	{
+		return (ft::_growth_max(capacity * __VECTOR_GROWTH_SIZE__, required));
+	}
+};
+
+struct growth_one_and_half
+{
+	template <class T>
+	static std::size_t next_capacity(std::size_t capacity, std::size_t required)
+	{
+		return (ft::_growth_max(capacity + (capacity / 2), required));
+	}
+};
+
+template <std::size_t Chunk>
+struct growth_fixed_chunk
+{
+	template <class T>
+	static std::size_t next_capacity(std::size_t capacity, std::size_t required)
+	{
+		(void)capacity;
+		return (ft::_growth_round_up(required, Chunk));
+	}
+};
+
+/*
+** a chunk of 0 elements makes no sense (and would divide by zero):
+** left undefined, so growth_fixed_chunk<0> doesn't compile once a Vector uses it
+*/
+template <>
+struct growth_fixed_chunk<0>;
+
+template <class Base = ft::growth_double, std::size_t PageSize = 4096>
+struct growth_page_rounded
+{
+	template <class T>
+	static std::size_t next_capacity(std::size_t capacity, std::size_t required)
+	{
+		std::size_t	bytes;
+
+		bytes = Base::template next_capacity<T>(capacity, required) * sizeof(T);
+		/*
+		** small buffers live in the allocator bins, no need to waste a whole page for them
+		*/
+		if (bytes >= PageSize)
+			bytes = ft::_growth_round_up(bytes, PageSize);
+		return (ft::_growth_max(bytes / sizeof(T), required));
+	}
+};
+
+/*
+** same for a page of 0 bytes
+*/
+template <class Base>
+struct growth_page_rounded<Base, 0>;
+
+/*
+** Most malloc implementations (jemalloc, tcmalloc, glibc for the small bins) serve a request
+** from the smallest size class that fits it, so asking for less than a class is wasted memory anyway.
+** The classes modeled here are the jemalloc ones: multiples of 16 bytes up to 128,
+** then four classes for every power of two.
+*/
+template <class Base = ft::growth_one_and_half>
+struct growth_size_class
+{
+	template <class T>
+	static std::size_t next_capacity(std::size_t capacity, std::size_t required)
+	{
+		std::size_t	bytes;
+		std::size_t	group;
+
+		bytes = Base::template next_capacity<T>(capacity, required) * sizeof(T);
+		if (bytes <= 128)
+			bytes = ft::_growth_round_up(bytes, 16);
+		else
+		{
+			group = 128;
+			while (group * 2 < bytes)
+				group *= 2;
+			bytes = ft::_growth_round_up(bytes, group / 4);
+		}
+		return (ft::_growth_max(bytes / sizeof(T), required));
+	}
+};
+
+};
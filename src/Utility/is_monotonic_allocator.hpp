@@ -0,0 +1,20 @@
+/*
+** Trait class that identifies whether Alloc is monotonic:
+** its deallocate does nothing, the memory is reclaimed all at once by its owner
+** (like ft::arena_allocator, which specializes this trait).
+** A container of trivially destructible elements using such an allocator can then
+** drop all of its elements without visiting them.
+*/
+
+# pragma once
+
+namespace ft
+{
+
+template <class Alloc>
+struct is_monotonic_allocator
+{
+	static const bool	value = false;
+};
+
+};
@@ -0,0 +1,27 @@
+/*
+** Trait class that identifies whether T and U are the same type,
+** with the same const and volatile qualifications.
+*/
+
+# pragma once
+
+namespace ft
+{
+
+template <class T, class U>
+struct is_same
+{
+    typedef T           type;
+
+    static const bool	value = false;
+};
+
+template <class T>
+struct is_same<T, T>
+{
+    typedef T           type;
+
+    static const bool	value = true;
+};
+
+};
@@ -0,0 +1,73 @@
+/*
+** Trait class that identifies whether T is a trivially copyable type.
+** A trivially copyable type can be copied with a plain memory copy (memcpy/memmove)
+** and its destructor does nothing, which is the case for:
+**
+** |--------------------------------|
+** | trivially copyable types       |
+** |--------------------------------|
+** | the fundamental integral types |
+** | float, double, long double     |
+** | pointers                       |
+** | POD structs and unions         |
+** |--------------------------------|
+**
+** C++98 has no way to ask this question in pure library code,
+** so we rely on the compiler builtin when it is available (gcc and clang provide it
+** in every language mode), otherwise we fallback to the fundamental types only.
+*/
+
+# pragma once
+
+# include "./is_integral.hpp"
+
+# if defined (__GNUC__) || defined (__clang__)
+#  define __FT_IS_TRIVIALLY_COPYABLE__(T) __is_trivially_copyable(T)
+# else
+#  define __FT_IS_TRIVIALLY_COPYABLE__(T) ft::is_integral<T>::value
+# endif
+
+namespace ft
+{
+
+template <class T>
+struct is_trivially_copyable
+{
+    typedef T           type;
+
+    static const bool	value = __FT_IS_TRIVIALLY_COPYABLE__(T);
+};
+
+template <class T>
+struct is_trivially_copyable<T*>
+{
+    typedef T*          type;
+
+    static const bool	value = true;
+};
+
+template <>
+struct is_trivially_copyable<float>
+{
+    typedef float       type;
+
+    static const bool	value = true;
+};
+
+template <>
+struct is_trivially_copyable<double>
+{
+    typedef double      type;
+
+    static const bool	value = true;
+};
+
+template <>
+struct is_trivially_copyable<long double>
+{
+    typedef long double	type;
+
+    static const bool	value = true;
+};
+
+};
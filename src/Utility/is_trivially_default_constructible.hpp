@@ -0,0 +1,72 @@
+/*
+** Trait class that identifies whether T is trivially default constructible.
+** Default constructing such a type does nothing at all: the object simply holds
+** whatever bytes were in its storage, so a container can skip the construction
+** of the slots it's about to overwrite.
+**
+** |--------------------------------|
+** | trivially default constructible|
+** |--------------------------------|
+** | the fundamental types          |
+** | pointers                       |
+** | POD structs and unions         |
+** |--------------------------------|
+**
+** Like is_trivially_copyable, we rely on the compiler builtin when it is available,
+** otherwise we fallback to the fundamental types only.
+*/
+
+# pragma once
+
+# include "./is_integral.hpp"
+
+# if defined (__GNUC__) || defined (__clang__)
+#  define __FT_IS_TRIVIALLY_DEFAULT_CONSTRUCTIBLE__(T) __is_trivially_constructible(T)
+# else
+#  define __FT_IS_TRIVIALLY_DEFAULT_CONSTRUCTIBLE__(T) ft::is_integral<T>::value
+# endif
+
+namespace ft
+{
+
+template <class T>
+struct is_trivially_default_constructible
+{
+    typedef T           type;
+
+    static const bool	value = __FT_IS_TRIVIALLY_DEFAULT_CONSTRUCTIBLE__(T);
+};
+
+template <class T>
+struct is_trivially_default_constructible<T*>
+{
+    typedef T*          type;
+
+    static const bool	value = true;
+};
+
+template <>
+struct is_trivially_default_constructible<float>
+{
+    typedef float       type;
+
+    static const bool	value = true;
+};
+
+template <>
+struct is_trivially_default_constructible<double>
+{
+    typedef double      type;
+
+    static const bool	value = true;
+};
+
+template <>
+struct is_trivially_default_constructible<long double>
+{
+    typedef long double	type;
+
+    static const bool	value = true;
+};
+
+};
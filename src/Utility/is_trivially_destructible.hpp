@@ -0,0 +1,85 @@
+/*
+** Trait class that identifies whether T is trivially destructible.
+** Destroying such an object does nothing at all, so a container
+** can release its storage without calling the destructor of its elements.
+**
+** |--------------------------------|
+** | trivially destructible         |
+** |--------------------------------|
+** | the fundamental types          |
+** | pointers                       |
+** | structs whose members all are  |
+** | trivially destructible         |
+** |--------------------------------|
+**
+** Like is_trivially_copyable, we rely on the compiler builtin when it is available,
+** otherwise we fallback to the fundamental types only.
+*/
+
+# pragma once
+
+# include "./is_integral.hpp"
+
+/*
+** clang deprecates __has_trivial_destructor (-Wdeprecated-builtins) in favor of __is_trivially_destructible,
+** which gcc only provides since gcc 14: gcc keeps the old spelling when it doesn't have the new one
+*/
+# if defined (__clang__)
+#  define __FT_IS_TRIVIALLY_DESTRUCTIBLE__(T) __is_trivially_destructible(T)
+# elif defined (__GNUC__)
+#  if defined (__has_builtin)
+#   if __has_builtin(__is_trivially_destructible)
+#    define __FT_IS_TRIVIALLY_DESTRUCTIBLE__(T) __is_trivially_destructible(T)
+#   endif
+#  endif
+#  ifndef __FT_IS_TRIVIALLY_DESTRUCTIBLE__
+#   define __FT_IS_TRIVIALLY_DESTRUCTIBLE__(T) __has_trivial_destructor(T)
+#  endif
+# else
+#  define __FT_IS_TRIVIALLY_DESTRUCTIBLE__(T) ft::is_integral<T>::value
+# endif
+
+namespace ft
+{
+
+template <class T>
+struct is_trivially_destructible
+{
+    typedef T           type;
+
+    static const bool	value = __FT_IS_TRIVIALLY_DESTRUCTIBLE__(T);
+};
+
+template <class T>
+struct is_trivially_destructible<T*>
+{
+    typedef T*          type;
+
+    static const bool	value = true;
+};
+
+template <>
+struct is_trivially_destructible<float>
+{
+    typedef float       type;
+
+    static const bool	value = true;
+};
+
+template <>
+struct is_trivially_destructible<double>
+{
+    typedef double      type;
+
+    static const bool	value = true;
+};
+
+template <>
+struct is_trivially_destructible<long double>
+{
+    typedef long double	type;
+
+    static const bool	value = true;
+};
+
+};
@@ -0,0 +1,40 @@
+/*
+** Trait class that identifies whether T is trivially relocatable.
+** Relocating an object means constructing a copy of it at a new address
+** and destroying the original one. For a trivially relocatable type,
+** this whole operation is equivalent to copying its bytes (memcpy) and
+** simply forgetting about the old storage, without calling any constructor or destructor.
+**
+** Every trivially copyable type is trivially relocatable, that's the default.
+** Many other types are trivially relocatable as well (e.g. a struct holding a pointer to
+** a heap buffer that it frees in its destructor) even if they are not trivially copyable,
+** for those types the trait can be specialized by the user:
+**
+** template <>
+** struct ft::is_trivially_relocatable<my_buffer>
+** {
+**     typedef my_buffer   type;
+**
+**     static const bool	value = true;
+** };
+**
+** Specializing it for a type that stores a pointer to itself (or is referenced
+** by address from somewhere else) is undefined behavior.
+*/
+
+# pragma once
+
+# include "./is_trivially_copyable.hpp"
+
+namespace ft
+{
+
+template <class T>
+struct is_trivially_relocatable
+{
+    typedef T           type;
+
+    static const bool	value = ft::is_trivially_copyable<T>::value;
+};
+
+};
@@ -0,0 +1,23 @@
+/*
+** Move helpers
+** The containers are written in C++98, but when they are compiled in C++11 (or later)
+** they can move their elements instead of copying them, this header hides the difference:
+**
+** |----------------------|------------------|-------------------------|
+** | macro                | C++98            | C++11 and later         |
+** |----------------------|------------------|-------------------------|
+** | __FT_CXX11__         | 0                | 1                       |
+** | __FT_MOVE__(x)       | x                | std::move(x)            |
+** |----------------------|------------------|-------------------------|
+*/
+
+# pragma once
+
+# if __cplusplus >= 201103L
+#  include <utility>
+#  define __FT_CXX11__ 1
+#  define __FT_MOVE__(x) std::move(x)
+# else
+#  define __FT_CXX11__ 0
+#  define __FT_MOVE__(x) (x)
+# endif
@@ -0,0 +1,400 @@
+/*
+** pool_allocator
+** An allocator for node based containers (ft::Map): single elements are carved out of
+** big slabs of fixed size blocks, and a freed block goes to a free list to be reused
+** by the next allocation, so a Map doesn't go to malloc for every insertion and doesn't
+** scatter its nodes all over the heap.
+**
+** ft::Map<int, int, std::less<int>, ft::pool_allocator<ft::pair<const int, int> > > m;
+**
+** - the copies of an allocator, rebound ones included (e.g. the node allocator of the tree),
+**   share the same set of pools (it's reference counted), so they all compare equal and
+**   any of them can deallocate what another one allocated.
+** - the set holds one pool per block size, created on the first allocation of that size:
+**   an allocator that never allocates (the one of the pairs in a Map) costs no pool.
+** - the slabs are only given back to the system when the last allocator using the set is destroyed.
+** - allocations of more than one element (which the tree never does) fallback to operator new.
+** - a pool is not thread safe, like the containers themselves.
+**
+** Defining __FT_MAP_POOL_ALLOCATOR__ before including map.hpp makes it the default
+** allocator of ft::Map (see default_map_allocator.hpp).
+*/
+
+# pragma once
+
+# include <cstddef>
+# include <new>
+# include <limits>
+# include "./move.hpp"
+# include "./alignment.hpp"
+
+/* number of blocks of the first slab of a pool, the next ones double up to __POOL_MAX_SLAB_BLOCKS__ */
+# define __POOL_FIRST_SLAB_BLOCKS__ 32
+# define __POOL_MAX_SLAB_BLOCKS__ 4096
+
+namespace ft
+{
+
+/*
+** A pool of fixed size blocks, owned by a pool_set
+*/
+class fixed_pool
+{
+	/* ============================== MEMBER TYPE ============================== */
+	private:
+		struct slab
+		{
+			slab	*next;
+		};
+
+	/* ============================== MEMBER ATTRIBUTES ============================== */
+	private:
+		std::size_t	_block_size;
+		std::size_t	_header_size;
+		std::size_t	_next_slab_blocks;
+		void		*_free;
+		slab		*_slabs;
+
+	public:
+		/*
+		** next pool of the same pool_set
+		*/
+		fixed_pool	*next;
+
+	/* ============================== CONSTRUCTORS/DESTRUCTOR ============================== */
+	public:
+		/*
+		** @param size size of an element
+		** @param align alignment of an element
+		*/
+		fixed_pool(std::size_t size, std::size_t align)
+		: _block_size(fixed_pool::block_size(size, align)), _next_slab_blocks(__POOL_FIRST_SLAB_BLOCKS__),
+		_free(0), _slabs(0), next(0)
+		{
+			this->_header_size = ft::align_up(sizeof(slab), __FT_ALIGNOF__(ft::max_align));
+		}
+
+		~fixed_pool()
+		{
+			slab	*next;
+
+			while (this->_slabs)
+			{
+				next = this->_slabs->next;
+				::operator delete(static_cast<void *>(this->_slabs));
+				this->_slabs = next;
+			}
+		}
+
+	private:
+		fixed_pool(const fixed_pool &);
+		fixed_pool &operator=(const fixed_pool &);
+
+	/* ============================== MEMBER FUNCTIONS ============================== */
+	public:
+		/*
+		** Size of the blocks for elements of the given size and alignment
+		** A free block holds the pointer to the next free block, and the block size is a multiple
+		** of the alignment, so two types with the same block size can share a pool.
+		** @param size size of an element
+		** @param align alignment of an element
+		** @return the size of a block
+		*/
+		static std::size_t	block_size(std::size_t size, std::size_t align)
+		{
+			if (size < sizeof(void *))
+				size = sizeof(void *);
+			if (align < __FT_ALIGNOF__(void *))
+				align = __FT_ALIGNOF__(void *);
+			return (ft::align_up(size, align));
+		}
+
+		std::size_t	block_size(void) const
+		{
+			return (this->_block_size);
+		}
+
+		/*
+		** Take a block from the free list, a new slab is allocated when it's empty
+		** @param void void
+		** @return a block of block_size bytes
+		*/
+		void	*allocate(void)
+		{
+			void	*block;
+
+			if (!this->_free)
+				this->_grow();
+			block = this->_free;
+			this->_free = *static_cast<void **>(block);
+			return (block);
+		}
+
+		/*
+		** Give a block back to the free list
+		** @param block block previously returned by allocate
+		** @return void
+		*/
+		void	deallocate(void *block)
+		{
+			*static_cast<void **>(block) = this->_free;
+			this->_free = block;
+		}
+
+	private:
+		/*
+		** Allocate a new slab and push all of its blocks to the free list
+		*/
+		void	_grow(void)
+		{
+			slab	*new_slab;
+			char	*block;
+
+			new_slab = static_cast<slab *>(::operator new(this->_header_size + this->_next_slab_blocks * this->_block_size));
+			new_slab->next = this->_slabs;
+			this->_slabs = new_slab;
+			block = reinterpret_cast<char *>(new_slab) + this->_header_size;
+			for (std::size_t i = 0; i < this->_next_slab_blocks; i++, block += this->_block_size)
+				this->deallocate(block);
+			if (this->_next_slab_blocks < __POOL_MAX_SLAB_BLOCKS__)
+				this->_next_slab_blocks *= 2;
+		}
+};
+
+/*
+** The pools of a family of pool_allocator (an allocator, its copies and its rebound copies),
+** one per block size, created on demand
+*/
+class pool_set
+{
+	/* ============================== MEMBER ATTRIBUTES ============================== */
+	private:
+		fixed_pool	*_pools;
+		std::size_t	_refs;
+
+	/* ============================== CONSTRUCTORS/DESTRUCTOR ============================== */
+	public:
+		pool_set()
+		: _pools(0), _refs(1)
+		{
+		}
+
+		~pool_set()
+		{
+			fixed_pool	*next;
+
+			while (this->_pools)
+			{
+				next = this->_pools->next;
+				delete this->_pools;
+				this->_pools = next;
+			}
+		}
+
+	private:
+		pool_set(const pool_set &);
+		pool_set &operator=(const pool_set &);
+
+	/* ============================== MEMBER FUNCTIONS ============================== */
+	public:
+		/*
+		** Get the pool for elements of the given size and alignment, it's created the first time
+		** (a set rarely holds more than two pools, a list is enough)
+		** @param size size of an element
+		** @param align alignment of an element
+		** @return the pool
+		*/
+		fixed_pool	*get(std::size_t size, std::size_t align)
+		{
+			std::size_t	block;
+			fixed_pool	*pool;
+
+			block = fixed_pool::block_size(size, align);
+			for (pool = this->_pools; pool; pool = pool->next)
+				if (pool->block_size() == block)
+					return (pool);
+			pool = new fixed_pool(size, align);
+			pool->next = this->_pools;
+			this->_pools = pool;
+			return (pool);
+		}
+
+		void	retain(void)
+		{
+			++this->_refs;
+		}
+
+		/*
+		** @return true if the caller was the last user of the set (which must be deleted then)
+		*/
+		bool	release(void)
+		{
+			return (--this->_refs == 0);
+		}
+};
+
+template <class T>
+class pool_allocator
+{
+	/* ============================== MEMBER TYPE ============================== */
+	public:
+		typedef T					value_type;
+		typedef T*					pointer;
+		typedef const T*			const_pointer;
+		typedef T&					reference;
+		typedef const T&			const_reference;
+		typedef std::size_t			size_type;
+		typedef std::ptrdiff_t		difference_type;
+
+		template <class U>
+		struct rebind
+		{
+			typedef pool_allocator<U>	other;
+		};
+
+	template <class U>
+	friend class pool_allocator;
+
+	/* ============================== MEMBER ATTRIBUTES ============================== */
+	private:
+		pool_set	*_pools;
+		/*
+		** the pool of the blocks of sizeof(T), looked up in the set on the first allocation
+		*/
+		fixed_pool	*_pool;
+
+	/* ============================== CONSTRUCTORS/DESTRUCTOR ============================== */
+	public:
+		pool_allocator()
+		: _pools(new pool_set()), _pool(0)
+		{
+		}
+
+		pool_allocator(const pool_allocator &x) throw()
+		: _pools(x._pools), _pool(x._pool)
+		{
+			this->_pools->retain();
+		}
+
+		/*
+		** a rebound allocator shares the set of pools, its blocks come from the pool of their size
+		*/
+		template <class U>
+		pool_allocator(const pool_allocator<U> &x) throw()
+		: _pools(x._pools), _pool(0)
+		{
+			this->_pools->retain();
+		}
+
+		~pool_allocator()
+		{
+			if (this->_pools->release())
+				delete this->_pools;
+		}
+
+		pool_allocator &operator=(const pool_allocator &x)
+		{
+			x._pools->retain();
+			if (this->_pools->release())
+				delete this->_pools;
+			this->_pools = x._pools;
+			this->_pool = x._pool;
+			return (*this);
+		}
+
+	/* ============================== MEMBER FUNCTIONS ============================== */
+	public:
+		pointer address(reference x) const
+		{
+			return (&x);
+		}
+
+		const_pointer address(const_reference x) const
+		{
+			return (&x);
+		}
+
+		/*
+		** Allocate storage for n elements, a single element comes from the pool
+		** @param n number of elements
+		** @param hint unused
+		** @return a pointer to the first element of the block
+		*/
+		pointer allocate(size_type n, const void *hint = 0)
+		{
+			(void)hint;
+			if (n == 1)
+				return (static_cast<pointer>(this->_get_pool()->allocate()));
+			if (n > this->max_size())
+				throw std::bad_alloc();
+			return (static_cast<pointer>(::operator new(n * sizeof(value_type))));
+		}
+
+		/*
+		** Release the storage of n elements previously allocated with allocate
+		** @param p pointer to the block
+		** @param n number of elements, must be the one given to allocate
+		** @return void
+		*/
+		void deallocate(pointer p, size_type n)
+		{
+			if (n == 1)
+				this->_get_pool()->deallocate(static_cast<void *>(p));
+			else
+				::operator delete(static_cast<void *>(p));
+		}
+
+		size_type max_size() const throw()
+		{
+			return (std::numeric_limits<size_type>::max() / sizeof(value_type));
+		}
+
+# if __FT_CXX11__
+		template <class U, class... Args>
+		void construct(U *p, Args&&... args)
+		{
+			new (static_cast<void *>(p)) U(std::forward<Args>(args)...);
+		}
+# else
+		void construct(pointer p, const_reference val)
+		{
+			new (static_cast<void *>(p)) value_type(val);
+		}
+# endif
+
+		void destroy(pointer p)
+		{
+			p->~value_type();
+		}
+
+		/*
+		** two allocators are equal when they share the same set of pools
+		*/
+		template <class U>
+		bool is_same_pool(const pool_allocator<U> &x) const
+		{
+			return (this->_pools == x._pools);
+		}
+
+	private:
+		fixed_pool	*_get_pool(void)
+		{
+			if (!this->_pool)
+				this->_pool = this->_pools->get(sizeof(T), __FT_ALIGNOF__(T));
+			return (this->_pool);
+		}
+};
+
+template <class T, class U>
+bool operator==(const pool_allocator<T> &lhs, const pool_allocator<U> &rhs)
+{
+	return (lhs.is_same_pool(rhs));
+}
+
+template <class T, class U>
+bool operator!=(const pool_allocator<T> &lhs, const pool_allocator<U> &rhs)
+{
+	return (!(lhs == rhs));
+}
+
+};
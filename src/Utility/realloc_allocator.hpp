@@ -0,0 +1,156 @@
+/*
+** realloc_allocator
+** An allocator backed by malloc/free that also implements the reallocate extension
+** (see allocator_reallocate.hpp) on top of std::realloc.
+** When a container of trivially relocatable elements grows, the block is extended in place
+** whenever the heap has room after it, and for large blocks the C library usually
+** remaps the pages (mremap on linux) instead of copying them.
+** In both cases, there's no transient peak where the old and the new buffers are alive at the same time.
+**
+** ft::Vector<int, ft::realloc_allocator<int> > v;
+*/
+
+# pragma once
+
+# include <cstdlib>
+# include <cstddef>
+# include <new>
+# include <limits>
+# include "./move.hpp"
+
+namespace ft
+{
+
+template <class T>
+class realloc_allocator
+{
+	/* ============================== MEMBER TYPE ============================== */
+	public:
+		typedef T					value_type;
+		typedef T*					pointer;
+		typedef const T*			const_pointer;
+		typedef T&					reference;
+		typedef const T&			const_reference;
+		typedef std::size_t			size_type;
+		typedef std::ptrdiff_t		difference_type;
+
+		template <class U>
+		struct rebind
+		{
+			typedef realloc_allocator<U>	other;
+		};
+
+	/* ============================== CONSTRUCTORS/DESTRUCTOR ============================== */
+	public:
+		realloc_allocator() throw()
+		{
+		}
+
+		realloc_allocator(const realloc_allocator &) throw()
+		{
+		}
+
+		template <class U>
+		realloc_allocator(const realloc_allocator<U> &) throw()
+		{
+		}
+
+		~realloc_allocator() throw()
+		{
+		}
+
+	/* ============================== MEMBER FUNCTIONS ============================== */
+	public:
+		pointer address(reference x) const
+		{
+			return (&x);
+		}
+
+		const_pointer address(const_reference x) const
+		{
+			return (&x);
+		}
+
+		/*
+		** Allocate a block of storage big enough to hold n elements
+		** @param n number of elements
+		** @param hint unused
+		** @return a pointer to the first element of the block
+		*/
+		pointer allocate(size_type n, const void *hint = 0)
+		{
+			void *p;
+
+			(void)hint;
+			if (n > this->max_size())
+				throw std::bad_alloc();
+			p = std::malloc(n * sizeof(value_type));
+			if (!p && n)
+				throw std::bad_alloc();
+			return (static_cast<pointer>(p));
+		}
+
+		/*
+		** Release a block of storage previously allocated with allocate or reallocate
+		** @param p pointer to the block
+		** @param n unused, the C library keeps track of it
+		** @return void
+		*/
+		void deallocate(pointer p, size_type n)
+		{
+			(void)n;
+			std::free(p);
+		}
+
+		/*
+		** Resize a block of storage, the content is preserved up to the smaller of the two sizes
+		** @param p block previously allocated by this allocator
+		** @param old_n unused, the C library keeps track of it
+		** @param new_n new number of elements
+		** @return the resized block, or a null pointer on failure (p stays valid)
+		*/
+		pointer reallocate(pointer p, size_type old_n, size_type new_n)
+		{
+			(void)old_n;
+			if (new_n > this->max_size() || !new_n)
+				return (0);
+			return (static_cast<pointer>(std::realloc(static_cast<void *>(p), new_n * sizeof(value_type))));
+		}
+
+		size_type max_size() const throw()
+		{
+			return (std::numeric_limits<size_type>::max() / sizeof(value_type));
+		}
+
+# if __FT_CXX11__
+		template <class U, class... Args>
+		void construct(U *p, Args&&... args)
+		{
+			new (static_cast<void *>(p)) U(std::forward<Args>(args)...);
+		}
+# else
+		void construct(pointer p, const_reference val)
+		{
+			new (static_cast<void *>(p)) value_type(val);
+		}
+# endif
+
+		void destroy(pointer p)
+		{
+			p->~value_type();
+		}
+};
+
+template <class T, class U>
+bool operator==(const realloc_allocator<T> &, const realloc_allocator<U> &)
+{
+	return (true);
+}
+
+template <class T, class U>
+bool operator!=(const realloc_allocator<T> &, const realloc_allocator<U> &)
+{
+	return (false);
+}
+
+};
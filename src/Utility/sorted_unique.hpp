@@ -0,0 +1,24 @@
+/*
+** sorted_unique
+** Tag telling a container constructor that its input range is already sorted
+** by key (following the comparison object of the container) and has no duplicates,
+** so the container can be built in O(n) without checking it.
+**
+** ft::Map<int, int> m(ft::sorted_unique, snapshot.begin(), snapshot.end());
+**
+** Passing a range that doesn't meet the precondition leaves the container in a broken state.
+*/
+
+# pragma once
+
+namespace ft
+{
+
+struct sorted_unique_t
+{
+	sorted_unique_t() {}
+};
+
+static const sorted_unique_t	sorted_unique;
+
+};
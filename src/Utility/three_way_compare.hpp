@@ -0,0 +1,102 @@
+/*
+** Optional comparison object extension: three-way comparison
+** A comparison object (the Compare parameter of ft::Map) can provide the member function:
+**
+**     int three_way(const key_type &a, const key_type &b) const;
+**
+** which returns a negative value if a goes before b, zero if they are equivalent,
+** and a positive value otherwise, consistently with its operator().
+** A lookup in the tree then does a single comparison per level and can stop as soon as the key is found,
+** instead of walking down to a leaf (that's what pays off for keys whose comparison is a walk,
+** like strings: std::string::compare gives the three answers for the price of one operator<).
+**
+** has_three_way detects the extension at compile time, and three_way_less is
+** a ready to use comparison object for any key type with a compare member function:
+**
+** ft::Map<std::string, int, ft::three_way_less<std::string> > m;
+*/
+
+# pragma once
+
+namespace ft
+{
+
+template <class Compare, class Key>
+struct has_three_way
+{
+	private:
+		typedef char	yes;
+		typedef struct { char c[2]; } no;
+
+		template <class U, int (U::*)(const Key &, const Key &) const>
+		struct check {};
+
+		template <class U>
+		static yes	test(check<U, &U::three_way> *);
+
+		template <class U>
+		static no	test(...);
+
+	public:
+		static const bool	value = (sizeof(test<Compare>(0)) == sizeof(yes));
+};
+
+template <class Compare, class Key, bool = ft::has_three_way<Compare, Key>::value>
+struct key_three_way
+{
+	/*
+	** the comparison object only knows operator<, it takes two calls
+	*/
+	static int call(const Compare &comp, const Key &a, const Key &b)
+	{
+		if (comp(a, b))
+			return (-1);
+		return (comp(b, a) ? 1 : 0);
+	}
+};
+
+template <class Compare, class Key>
+struct key_three_way<Compare, Key, true>
+{
+	static int call(const Compare &comp, const Key &a, const Key &b)
+	{
+		return (comp.three_way(a, b));
+	}
+};
+
+/*
+** Three-way compare a and b with comp
+** @param comp the comparison object
+** @param a the first key
+** @param b the second key
+** @return a negative value if a goes before b, 0 if they are equivalent, a positive value otherwise
+*/
+template <class Compare, class Key>
+int	three_way(const Compare &comp, const Key &a, const Key &b)
+{
+	return (ft::key_three_way<Compare, Key>::call(comp, a, b));
+}
+
+/*
+** Comparison object ordering the keys with their compare member function
+** (std::string, or any type with the same interface)
+*/
+template <class Key>
+struct three_way_less
+{
+	typedef Key		first_argument_type;
+	typedef Key		second_argument_type;
+	typedef bool	result_type;
+
+	bool operator()(const Key &a, const Key &b) const
+	{
+		return (a.compare(b) < 0);
+	}
+
+	int three_way(const Key &a, const Key &b) const
+	{
+		return (a.compare(b));
+	}
+};
+
+};
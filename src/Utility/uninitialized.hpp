@@ -0,0 +1,184 @@
+/*
+** Low level helpers working on uninitialized memory.
+** They are used by the containers to move their elements between buffers,
+** taking a fast path (a single memory copy) whenever the element type allows it.
+*/
+
+# pragma once
+
+# include <cstddef>
+# include <cstring>
+# include "./is_trivially_relocatable.hpp"
+# include "./is_trivially_copyable.hpp"
+# include "./is_same.hpp"
+# include "./Iterators/is_contiguous_iterator.hpp"
+# include "./move.hpp"
+
+namespace ft
+{
+
+/*
+** Relocate the range [first, last) into the uninitialized memory starting at dest
+** (the elements are moved when compiled in C++11, copied otherwise)
+** After the call, the objects in [first, last) are destroyed (their storage can be deallocated),
+** and [dest, dest + (last - first)) holds the same objects.
+** The two ranges must not overlap.
+** @param alloc allocator used to construct/destroy the elements
+** @param first pointer to the first element to relocate
+** @param last pointer past the last element to relocate
+** @param dest pointer to the uninitialized destination
+** @return pointer past the last relocated element in the destination
+*/
+template <class Alloc, class T>
+T	*uninitialized_relocate(Alloc &alloc, T *first, T *last, T *dest)
+{
+	if (ft::is_trivially_relocatable<T>::value)
+	{
+		if (first != last)
+			std::memcpy(static_cast<void *>(dest), static_cast<const void *>(first), (last - first) * sizeof(T));
+		return (dest + (last - first));
+	}
+	for (; first != last; ++first, ++dest)
+	{
+		alloc.construct(dest, __FT_MOVE__(*first));
+		alloc.destroy(first);
+	}
+	return (dest);
+}
+
+/*
+** Shift the range [first, last) n positions to the right, inside the same buffer
+** [last, last + n) must be uninitialized memory, after the call it's [first, first + n)
+** that is uninitialized (ready to receive new elements), while [first + n, last + n)
+** holds the shifted elements.
+** @param alloc allocator used to construct/destroy the elements
+** @param first pointer to the first element to shift
+** @param last pointer past the last element to shift
+** @param n number of positions
+** @return void
+*/
+template <class Alloc, class T>
+void	uninitialized_shift_right(Alloc &alloc, T *first, T *last, std::size_t n)
+{
+	T	*src;
+
+	if (!n || first == last)
+		return ;
+	if (ft::is_trivially_relocatable<T>::value)
+	{
+		std::memmove(static_cast<void *>(first + n), static_cast<const void *>(first), (last - first) * sizeof(T));
+		return ;
+	}
+	/*
+	** walk backward so no element is overwritten before being shifted,
+	** the destinations past last are raw memory, the others are assigned
+	*/
+	src = last;
+	while (src != first)
+	{
+		--src;
+		if (src + n >= last)
+			alloc.construct(src + n, __FT_MOVE__(*src));
+		else
+			src[n] = __FT_MOVE__(*src);
+	}
+	for (src = first; src != last && src != first + n; ++src)
+		alloc.destroy(src);
+}
+
+/*
+** Erase the elements [first, last) from the initialized range [first, end)
+** The elements of [last, end) are shifted to first, after the call
+** [first, end - (last - first)) holds the remaining elements and the rest is uninitialized.
+** Trivially relocatable elements are moved with a single memmove, the others are
+** assigned one by one and only the trailing elements left behind are destroyed.
+** @param alloc allocator used to destroy the elements
+** @param first pointer to the first element to erase
+** @param last pointer past the last element to erase
+** @param end pointer past the last element of the range
+** @return pointer past the last remaining element
+*/
+template <class Alloc, class T>
+T	*erase_shift_left(Alloc &alloc, T *first, T *last, T *end)
+{
+	T	*new_end;
+
+	new_end = first + (end - last);
+	if (first == last)
+		return (end);
+	if (ft::is_trivially_relocatable<T>::value)
+	{
+		for (T *it = first; it != last; ++it)
+			alloc.destroy(it);
+		std::memmove(static_cast<void *>(first), static_cast<const void *>(last), (end - last) * sizeof(T));
+		return (new_end);
+	}
+	for (; last != end; ++first, ++last)
+		*first = __FT_MOVE__(*last);
+	for (; first != end; ++first)
+		alloc.destroy(first);
+	return (new_end);
+}
+
+/*
+** true when the range [first, last) of InputIterator can be copied into
+** an array of T with a single memcpy
+*/
+template <class InputIterator, class T>
+struct is_memcpy_copyable
+{
+	typedef InputIterator	type;
+
+	static const bool	value = ft::is_contiguous_iterator<InputIterator>::value
+		&& ft::is_same<typename ft::is_contiguous_iterator<InputIterator>::element_type, T>::value
+		&& ft::is_trivially_copyable<T>::value;
+};
+
+template <class InputIterator, class T, bool = ft::is_memcpy_copyable<InputIterator, T>::value>
+struct uninitialized_copier
+{
+	template <class Alloc>
+	static T	*call(Alloc &alloc, InputIterator first, InputIterator last, T *dest)
+	{
+		for (; first != last; ++first, ++dest)
+			alloc.construct(dest, *first);
+		return (dest);
+	}
+};
+
+template <class InputIterator, class T>
+struct uninitialized_copier<InputIterator, T, true>
+{
+	template <class Alloc>
+	static T	*call(Alloc &alloc, InputIterator first, InputIterator last, T *dest)
+	{
+		std::size_t	n;
+
+		(void)alloc;
+		n = last - first;
+		if (n)
+			std::memcpy(static_cast<void *>(dest),
+				static_cast<const void *>(ft::is_contiguous_iterator<InputIterator>::address(first)),
+				n * sizeof(T));
+		return (dest + n);
+	}
+};
+
+/*
+** Copy construct the range [first, last) into the uninitialized memory starting at dest
+** Contiguous ranges (see is_contiguous_iterator.hpp) of trivially copyable elements
+** are copied with a single memcpy, the others are constructed one by one.
+** The two ranges must not overlap.
+** @param alloc allocator used to construct the elements
+** @param first iterator to the first element to copy
+** @param last iterator past the last element to copy
+** @param dest pointer to the uninitialized destination
+** @return pointer past the last constructed element in the destination
+*/
+template <class Alloc, class InputIterator, class T>
+T	*uninitialized_copy(Alloc &alloc, InputIterator first, InputIterator last, T *dest)
+{
+	return (ft::uninitialized_copier<InputIterator, T>::call(alloc, first, last, dest));
+}
+
+};
@@ -0,0 +1,208 @@
+/*
+** Implementation of the benchmark harness: clock, allocation counter,
+** peak RSS, and the runner that forks a child process for every measure.
+*/
+
+# include "./benchmark.hpp"
+
+# include <cstdio>
+# include <cstdlib>
+# include <cstring>
+# include <new>
+# include <string>
+# include <time.h>
+# include <sys/time.h>
+# include <sys/resource.h>
+# include <sys/wait.h>
+# include <unistd.h>
+
+/* ============================== ALLOCATION COUNTER ============================== */
+/*
+** The global operator new is replaced so every allocation of the process
+** (the containers use std::allocator, which ends up here) is counted.
+*/
+# if __cplusplus >= 201103L
+#  define __BENCH_THROW_BAD_ALLOC__
+#  define __BENCH_NOTHROW__ noexcept
+# else
+#  define __BENCH_THROW_BAD_ALLOC__ throw(std::bad_alloc)
+#  define __BENCH_NOTHROW__ throw()
+# endif
+
+void	*operator new(std::size_t n) __BENCH_THROW_BAD_ALLOC__
+{
+	void	*p;
+
+	++bench::g_allocations;
+	p = std::malloc(n ? n : 1);
+	if (!p)
+		throw std::bad_alloc();
+	return (p);
+}
+
+void	*operator new[](std::size_t n) __BENCH_THROW_BAD_ALLOC__
+{
+	return (::operator new(n));
+}
+
+void	operator delete(void *p) __BENCH_NOTHROW__
+{
+	std::free(p);
+}
+
+void	operator delete[](void *p) __BENCH_NOTHROW__
+{
+	std::free(p);
+}
+
+namespace bench
+{
+
+std::size_t	g_allocations = 0;
+
+double	now_ns(void)
+{
+# if defined (CLOCK_MONOTONIC)
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1e9 + ts.tv_nsec);
+# else
+	struct timeval	tv;
+
+	gettimeofday(&tv, NULL);
+	return (tv.tv_sec * 1e9 + tv.tv_usec * 1e3);
+# endif
+}
+
+long	peak_rss_kib(void)
+{
+	struct rusage	usage;
+
+	if (getrusage(RUSAGE_SELF, &usage))
+		return (0);
+# if defined (__APPLE__)
+	/* bytes on macOS, KiB everywhere else */
+	return (usage.ru_maxrss / 1024);
+# else
+	return (usage.ru_maxrss);
+# endif
+}
+
+/*
+** what a child process sends back to the runner
+*/
+struct measure
+{
+	double	ns_per_op;
+	double	allocations_per_op;
+	long	peak_rss_kib;
+};
+
+/*
+** Run fn at size n in a child process
+** @param fn the benchmark
+** @param n size of the benchmarked container
+** @param min_ns minimum timed duration
+** @param m where the result is stored
+** @return true on success, false if the child failed (crash, out of memory...)
+*/
+static bool	measure_in_child(function fn, std::size_t n, double min_ns, measure &m)
+{
+	int		fds[2];
+	int		status;
+	pid_t	pid;
+	bool	ok;
+
+	if (pipe(fds))
+		return (false);
+	std::fflush(stdout);
+	pid = fork();
+	if (pid < 0)
+		return (false);
+	if (!pid)
+	{
+		state	st(n, min_ns);
+
+		close(fds[0]);
+		fn(st);
+		m.ns_per_op = st.ns_per_op();
+		m.allocations_per_op = st.allocations_per_op();
+		m.peak_rss_kib = peak_rss_kib();
+		ok = (write(fds[1], &m, sizeof(m)) == static_cast<ssize_t>(sizeof(m)));
+		_exit(ok ? 0 : 1);
+	}
+	close(fds[1]);
+	ok = (read(fds[0], &m, sizeof(m)) == static_cast<ssize_t>(sizeof(m)));
+	close(fds[0]);
+	waitpid(pid, &status, 0);
+	return (ok && WIFEXITED(status) && !WEXITSTATUS(status));
+}
+
+static void	print_rss(long kib)
+{
+	if (kib >= 10 * 1024)
+		std::printf(" %8.1fM", kib / 1024.0);
+	else
+		std::printf(" %8ldK", kib);
+}
+
+int	run(const benchmark *table, std::size_t count, int argc, char **argv)
+{
+	std::size_t	max_n;
+	double		min_ns;
+	const char	*filter;
+	std::string	name;
+	measure		std_m;
+	measure		ft_m;
+	bool		std_ok;
+	bool		ft_ok;
+
+	max_n = 10000000;
+	min_ns = 100 * 1e6;
+	filter = NULL;
+	for (int i = 1; i < argc; i++)
+	{
+		if (!std::strncmp(argv[i], "--max=", 6))
+			max_n = std::strtoul(argv[i] + 6, NULL, 10);
+		else if (!std::strncmp(argv[i], "--min-time=", 11))
+			min_ns = std::strtod(argv[i] + 11, NULL) * 1e6;
+		else if (!std::strncmp(argv[i], "--filter=", 9))
+			filter = argv[i] + 9;
+		else
+		{
+			std::fprintf(stderr, "usage: %s [--max=N] [--min-time=MS] [--filter=STR]\n", argv[0]);
+			return (1);
+		}
+	}
+	std::printf("%-26s %9s %11s %11s %7s %11s %11s %9s %9s\n",
+		"benchmark", "size", "std ns/op", "ft ns/op", "ft/std",
+		"std allocs", "ft allocs", "std RSS", "ft RSS");
+	for (std::size_t i = 0; i < count; i++)
+	{
+		name = std::string(table[i].container) + "/" + table[i].operation;
+		if (filter && name.find(filter) == std::string::npos)
+			continue ;
+		for (std::size_t n = 10; n <= max_n && n <= table[i].max_n; n *= 10)
+		{
+			std_ok = measure_in_child(table[i].std_function, n, min_ns, std_m);
+			ft_ok = measure_in_child(table[i].ft_function, n, min_ns, ft_m);
+			std::printf("%-26s %9lu", name.c_str(), static_cast<unsigned long>(n));
+			if (!std_ok || !ft_ok)
+			{
+				std::printf("  %s\n", !std_ok ? "std:: run failed" : "ft:: run failed");
+				continue ;
+			}
+			std::printf(" %11.2f %11.2f %6.2fx %11.3f %11.3f",
+				std_m.ns_per_op, ft_m.ns_per_op,
+				std_m.ns_per_op > 0 ? ft_m.ns_per_op / std_m.ns_per_op : 0,
+				std_m.allocations_per_op, ft_m.allocations_per_op);
+			print_rss(std_m.peak_rss_kib);
+			print_rss(ft_m.peak_rss_kib);
+			std::printf("\n");
+		}
+	}
+	return (0);
+}
+
+};
@@ -0,0 +1,204 @@
+/*
+** BENCHMARK:
+** A tiny micro-benchmark harness in the spirit of google-benchmark, written in C++98
+** so it builds with the same flags as the containers.
+**
+** A benchmark is a function taking a bench::state, it prepares its data then
+** loops on keep_running(), only the body of the loop is timed:
+**
+**     template <class V>
+**     void vector_iterate(bench::state &st)
+**     {
+**         V v(st.n, 42);
+**         long sum = 0;
+**
+**         while (st.keep_running())
+**             for (typename V::iterator it = v.begin(); it != v.end(); ++it)
+**                 sum += *it;
+**         bench::do_not_optimize(sum);
+**     }
+**
+** The loop runs until it has been timed for at least --min-time milliseconds,
+** work that must not be measured (e.g. refilling a container) goes between pause() and resume().
+** Every iteration is considered as st.n operations, unless the benchmark says otherwise with set_ops().
+**
+** Each (benchmark, size, implementation) runs in its own child process, so the reported
+** peak RSS (see getrusage) belongs to that run only, and a crash doesn't stop the whole suite.
+** The allocations are counted by the replaced global operator new (see benchmark.cpp).
+*/
+
+# pragma once
+
+# include <cstddef>
+
+namespace bench
+{
+
+/* number of calls to the global operator new since the start of the process */
+extern std::size_t	g_allocations;
+
+/*
+** current time of a monotonic clock, in nanoseconds
+*/
+double	now_ns(void);
+
+/*
+** peak resident set size of the current process, in KiB
+*/
+long	peak_rss_kib(void);
+
+/*
+** Prevent the compiler from optimizing away the computation of value
+** With gcc and clang, an empty asm statement takes value as an input (and clobbers the memory),
+** so the compiler has to compute it. A volatile read of a local isn't enough: gcc drops the
+** computation (e.g. the std::map lookups of Map/lower_bound were reduced to a bare descent).
+*/
+template <class T>
+void	do_not_optimize(const T &value)
+{
+# if defined (__GNUC__) || defined (__clang__)
+	__asm__ __volatile__("" : : "m"(value) : "memory");
+# else
+	volatile const char	*sink;
+
+	sink = reinterpret_cast<volatile const char *>(&value);
+	(void)*sink;
+# endif
+}
+
+class state
+{
+	/* ============================== MEMBER ATTRIBUTES ============================== */
+	public:
+		/* size of the benchmarked container */
+		const std::size_t	n;
+
+	private:
+		double			_min_ns;
+		double			_start;
+		double			_elapsed;
+		std::size_t		_iterations;
+		std::size_t		_next_check;
+		std::size_t		_ops;
+		std::size_t		_alloc_start;
+		std::size_t		_allocations;
+		bool			_running;
+		unsigned long	_seed;
+
+	/* ============================== CONSTRUCTORS/DESTRUCTOR ============================== */
+	public:
+		state(std::size_t size, double min_ns)
+		: n(size), _min_ns(min_ns), _start(0), _elapsed(0), _iterations(0), _next_check(1),
+		_ops(size), _alloc_start(0), _allocations(0), _running(false), _seed(2463534242UL)
+		{
+		}
+
+	/* ============================== MEMBER FUNCTIONS ============================== */
+	public:
+		/*
+		** Start/continue the timed loop
+		** The clock is only read every now and then (the interval doubles each time),
+		** so it doesn't weigh on the tiny sizes.
+		** @param void void
+		** @return true while the loop body must run once more
+		*/
+		bool	keep_running(void)
+		{
+			if (!this->_running)
+			{
+				this->_running = true;
+				this->resume();
+				return (true);
+			}
+			++this->_iterations;
+			if (this->_iterations < this->_next_check)
+				return (true);
+			this->_next_check *= 2;
+			if (this->_elapsed + (now_ns() - this->_start) < this->_min_ns)
+				return (true);
+			this->pause();
+			this->_running = false;
+			return (false);
+		}
+
+		/*
+		** Stop the clock (and the allocation counter) until resume is called
+		*/
+		void	pause(void)
+		{
+			this->_elapsed += now_ns() - this->_start;
+			this->_allocations += g_allocations - this->_alloc_start;
+		}
+
+		/*
+		** Restart the clock (and the allocation counter) after a pause
+		*/
+		void	resume(void)
+		{
+			this->_alloc_start = g_allocations;
+			this->_start = now_ns();
+		}
+
+		/*
+		** Set the number of operations performed by one iteration of the timed loop
+		** @param ops number of operations, n by default
+		** @return void
+		*/
+		void	set_ops(std::size_t ops)
+		{
+			this->_ops = ops;
+		}
+
+		/*
+		** xorshift pseudo random generator, the sequence is the same on every run
+		** @param void void
+		** @return a pseudo random number
+		*/
+		unsigned long	random(void)
+		{
+			this->_seed ^= this->_seed << 13;
+			this->_seed ^= this->_seed >> 7;
+			this->_seed ^= this->_seed << 17;
+			return (this->_seed);
+		}
+
+		double	ns_per_op(void) const
+		{
+			if (!this->_iterations || !this->_ops)
+				return (0);
+			return (this->_elapsed / (static_cast<double>(this->_iterations) * this->_ops));
+		}
+
+		double	allocations_per_op(void) const
+		{
+			if (!this->_iterations || !this->_ops)
+				return (0);
+			return (this->_allocations / (static_cast<double>(this->_iterations) * this->_ops));
+		}
+};
+
+typedef void	(*function)(state &);
+
+/*
+** One line of the report: the same operation measured on std:: and on ft::
+** max_n caps the size for the operations that are quadratic on purpose (e.g. inserting at the front)
+*/
+struct benchmark
+{
+	const char		*container;
+	const char		*operation;
+	function		std_function;
+	function		ft_function;
+	std::size_t		max_n;
+};
+
+/*
+** Run every benchmark of the table at the sizes 10, 100, ..., 10^7 and print the report
+** options: --max=N (biggest size), --filter=STR (only the lines containing STR), --min-time=MS
+** @param table the benchmarks
+** @param count number of benchmarks in the table
+** @return the exit status of the program
+*/
+int	run(const benchmark *table, std::size_t count, int argc, char **argv);
+
+};
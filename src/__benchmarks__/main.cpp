@@ -0,0 +1,479 @@
+/*
+** Benchmarks of the containers against their std:: counterparts
+** make bench                                  -> every benchmark, sizes 10 to 10^7
+** ./bench --max=100000 --filter=Map/find      -> a subset
+*/
+
+#include <vector>
+#include <map>
+#include <stack>
+#include "./benchmark.hpp"
+#include "../containers/map.hpp"
+#include "../containers/vector.hpp"
+#include "../containers/stack.hpp"
+#include "../Utility/pool_allocator.hpp"
+#include "../Utility/arena_allocator.hpp"
+#include "../Utility/avl_augmentation.hpp"
+
+/* sizes above this are skipped for the operations that are quadratic by nature */
+#define __BENCH_QUADRATIC_MAX__ 100000
+
+#define __BENCH_NO_MAX__ static_cast<std::size_t>(-1)
+
+/* ============================== HELPERS ============================== */
+/*
+** the keys 0..n-1 in a pseudo random order (the same for every run)
+*/
+static std::vector<int>	shuffled_keys(bench::state &st)
+{
+	std::vector<int>	keys(st.n);
+
+	for (std::size_t i = 0; i < st.n; i++)
+		keys[i] = static_cast<int>(i);
+	for (std::size_t i = st.n; i > 1; i--)
+		std::swap(keys[i - 1], keys[st.random() % i]);
+	return (keys);
+}
+
+template <class V>
+static void	fill_vector(V &v, std::size_t n)
+{
+	for (std::size_t i = 0; i < n; i++)
+		v.push_back(static_cast<int>(i));
+}
+
+template <class M>
+static void	fill_map(M &m, const std::vector<int> &keys)
+{
+	for (std::size_t i = 0; i < keys.size(); i++)
+		m.insert(typename M::value_type(keys[i], keys[i]));
+}
+
+/* ============================== VECTOR ============================== */
+template <class V>
+static void	vector_push_back(bench::state &st)
+{
+	while (st.keep_running())
+	{
+		V	v;
+
+		fill_vector(v, st.n);
+		st.pause();
+		v.clear();
+		st.resume();
+	}
+}
+
+/*
+** insert in the middle, each element shifts half of the content
+*/
+template <class V>
+static void	vector_insert(bench::state &st)
+{
+	while (st.keep_running())
+	{
+		V	v;
+
+		for (std::size_t i = 0; i < st.n; i++)
+			v.insert(v.begin() + v.size() / 2, static_cast<int>(i));
+	}
+}
+
+/*
+** erase from the middle until the Vector is empty
+*/
+template <class V>
+static void	vector_erase(bench::state &st)
+{
+	V	v;
+
+	while (st.keep_running())
+	{
+		st.pause();
+		fill_vector(v, st.n);
+		st.resume();
+		while (!v.empty())
+			v.erase(v.begin() + v.size() / 2);
+	}
+}
+
+template <class V>
+static void	vector_iterate(bench::state &st)
+{
+	V		v;
+	long	sum;
+
+	fill_vector(v, st.n);
+	sum = 0;
+	while (st.keep_running())
+		for (typename V::iterator it = v.begin(); it != v.end(); ++it)
+			sum += *it;
+	bench::do_not_optimize(sum);
+}
+
+template <class V>
+static void	vector_copy(bench::state &st)
+{
+	V	v;
+
+	fill_vector(v, st.n);
+	while (st.keep_running())
+	{
+		V	copy(v);
+
+		bench::do_not_optimize(copy[0]);
+	}
+}
+
+template <class V>
+static void	vector_clear(bench::state &st)
+{
+	V	v;
+
+	while (st.keep_running())
+	{
+		st.pause();
+		fill_vector(v, st.n);
+		st.resume();
+		v.clear();
+	}
+}
+
+/* ============================== MAP ============================== */
+template <class M>
+static void	map_insert(bench::state &st)
+{
+	std::vector<int>	keys;
+
+	keys = shuffled_keys(st);
+	while (st.keep_running())
+	{
+		M	m;
+
+		fill_map(m, keys);
+		st.pause();
+		m.clear();
+		st.resume();
+	}
+}
+
+/*
+** in order appends with end() as the hint, like a time series
+*/
+template <class M>
+static void	map_append(bench::state &st)
+{
+	while (st.keep_running())
+	{
+		M	m;
+
+		for (std::size_t i = 0; i < st.n; i++)
+			m.insert(m.end(), typename M::value_type(static_cast<int>(i), static_cast<int>(i)));
+		st.pause();
+		m.clear();
+		st.resume();
+	}
+}
+
+template <class M>
+static void	map_find(bench::state &st)
+{
+	std::vector<int>	keys;
+	M					m;
+	long				sum;
+
+	keys = shuffled_keys(st);
+	fill_map(m, keys);
+	sum = 0;
+	while (st.keep_running())
+		for (std::size_t i = 0; i < keys.size(); i++)
+			sum += m.find(keys[i])->second;
+	bench::do_not_optimize(sum);
+}
+
+/*
+** the map holds the even keys, and half of the lookups fall between two of them
+** (key * 2 - 1 has the same lower bound as key * 2): the lookups spread over the whole map, like find
+*/
+template <class M>
+static void	map_lower_bound(bench::state &st)
+{
+	std::vector<int>	keys;
+	M					m;
+	long				sum;
+
+	keys = shuffled_keys(st);
+	for (std::size_t i = 0; i < keys.size(); i++)
+		m.insert(typename M::value_type(keys[i] * 2, keys[i]));
+	sum = 0;
+	while (st.keep_running())
+		for (std::size_t i = 0; i < keys.size(); i++)
+			sum += m.lower_bound(keys[i] * 2 - static_cast<int>(i & 1))->second;
+	bench::do_not_optimize(sum);
+}
+
+template <class M>
+static void	map_erase(bench::state &st)
+{
+	std::vector<int>	keys;
+	M					m;
+
+	keys = shuffled_keys(st);
+	while (st.keep_running())
+	{
+		st.pause();
+		fill_map(m, keys);
+		st.resume();
+		for (std::size_t i = 0; i < keys.size(); i++)
+			m.erase(keys[i]);
+	}
+}
+
+/*
+** evict the oldest tenth of a time window, then refill it
+*/
+template <class M>
+static void	map_erase_range(bench::state &st)
+{
+	M		m;
+	int		oldest;
+	int		batch;
+
+	batch = static_cast<int>(st.n / 10 + 1);
+	for (std::size_t i = 0; i < st.n; i++)
+		m.insert(m.end(), typename M::value_type(static_cast<int>(i), 0));
+	oldest = 0;
+	while (st.keep_running())
+	{
+		m.erase(m.begin(), m.lower_bound(oldest + batch));
+		st.pause();
+		for (int i = 0; i < batch; i++)
+			m.insert(m.end(), typename M::value_type(oldest + static_cast<int>(st.n) + i, 0));
+		oldest += batch;
+		st.resume();
+	}
+}
+
+template <class M>
+static void	map_iterate(bench::state &st)
+{
+	M		m;
+	long	sum;
+
+	fill_map(m, shuffled_keys(st));
+	sum = 0;
+	while (st.keep_running())
+		for (typename M::iterator it = m.begin(); it != m.end(); ++it)
+			sum += it->second;
+	bench::do_not_optimize(sum);
+}
+
+template <class M>
+static void	map_copy(bench::state &st)
+{
+	M	m;
+
+	fill_map(m, shuffled_keys(st));
+	while (st.keep_running())
+	{
+		M	copy(m);
+
+		bench::do_not_optimize(copy.begin()->second);
+		st.pause();
+		copy.clear();
+		st.resume();
+	}
+}
+
+template <class M>
+static void	map_clear(bench::state &st)
+{
+	std::vector<int>	keys;
+	M					m;
+
+	keys = shuffled_keys(st);
+	while (st.keep_running())
+	{
+		st.pause();
+		fill_map(m, keys);
+		st.resume();
+		m.clear();
+	}
+}
+
+/*
+** construction from a sorted range, like a snapshot being loaded
+*/
+template <class M, class Pair>
+static void	map_from_sorted(bench::state &st)
+{
+	std::vector<Pair>	snapshot;
+
+	for (std::size_t i = 0; i < st.n; i++)
+		snapshot.push_back(Pair(static_cast<int>(i), static_cast<int>(i)));
+	while (st.keep_running())
+	{
+		M	m(snapshot.begin(), snapshot.end());
+
+		bench::do_not_optimize(m.begin()->second);
+	}
+}
+
+/*
+** a short lived map: filled, then destroyed
+*/
+template <class M>
+static void	map_scratch(bench::state &st)
+{
+	std::vector<int>	keys;
+
+	keys = shuffled_keys(st);
+	while (st.keep_running())
+	{
+		M	m;
+
+		fill_map(m, keys);
+	}
+}
+
+typedef ft::Map<int, int, std::less<int>, ft::arena_allocator<ft::pair<const int, int> > >	ft_arena_map;
+typedef std::map<int, int>	std_map_sum;
+typedef ft::Map<int, int, std::less<int>, std::allocator<ft::pair<const int, int> >, ft::subtree_aggregate<ft::sum_monoid<long> > >	ft_sum_map;
+
+/*
+** the same with its nodes in an arena, released after every map
+*/
+static void	map_scratch_arena(bench::state &st)
+{
+	std::vector<int>	keys;
+	ft::arena			scratch;
+
+	keys = shuffled_keys(st);
+	while (st.keep_running())
+	{
+		{
+			ft_arena_map	m(std::less<int>(), scratch);
+
+			fill_map(m, keys);
+		}
+		scratch.release();
+	}
+}
+
+/*
+** sum the values of a sliding window of a tenth of the keys, by walking it
+*/
+static void	map_window_sum(bench::state &st)
+{
+	std_map_sum	m;
+	int			window;
+	long		sum;
+
+	fill_map(m, shuffled_keys(st));
+	window = static_cast<int>(st.n / 10 + 1);
+	sum = 0;
+	while (st.keep_running())
+		for (int lo = 0; lo < static_cast<int>(st.n); lo += window / 4 + 1)
+			for (std_map_sum::iterator it = m.lower_bound(lo); it != m.lower_bound(lo + window); ++it)
+				sum += it->second;
+	bench::do_not_optimize(sum);
+}
+
+/*
+** the same with the sums kept in the nodes of the tree
+*/
+static void	map_window_sum_aggregate(bench::state &st)
+{
+	ft_sum_map	m;
+	int			window;
+	long		sum;
+
+	fill_map(m, shuffled_keys(st));
+	window = static_cast<int>(st.n / 10 + 1);
+	sum = 0;
+	while (st.keep_running())
+		for (int lo = 0; lo < static_cast<int>(st.n); lo += window / 4 + 1)
+			sum += m.aggregate(lo, lo + window);
+	bench::do_not_optimize(sum);
+}
+
+/* ============================== STACK ============================== */
+template <class S>
+static void	stack_push(bench::state &st)
+{
+	while (st.keep_running())
+	{
+		S	s;
+
+		for (std::size_t i = 0; i < st.n; i++)
+			s.push(static_cast<int>(i));
+		st.pause();
+		while (!s.empty())
+			s.pop();
+		st.resume();
+	}
+}
+
+template <class S>
+static void	stack_pop(bench::state &st)
+{
+	S		s;
+	long	sum;
+
+	sum = 0;
+	while (st.keep_running())
+	{
+		st.pause();
+		for (std::size_t i = 0; i < st.n; i++)
+			s.push(static_cast<int>(i));
+		st.resume();
+		while (!s.empty())
+		{
+			sum += s.top();
+			s.pop();
+		}
+	}
+	bench::do_not_optimize(sum);
+}
+
+/* ============================== TABLE ============================== */
+typedef std::vector<int>	std_vector;
+typedef ft::Vector<int>		ft_vector;
+typedef std::map<int, int>	std_map;
+typedef ft::Map<int, int>	ft_map;
+typedef ft::Map<int, int, std::less<int>, ft::pool_allocator<ft::pair<const int, int> > >	ft_pool_map;
+typedef std::stack<int>		std_stack;
+typedef ft::Stack<int>		ft_stack;
+
+static const bench::benchmark	g_benchmarks[] = {
+	{"Vector", "push_back", &vector_push_back<std_vector>, &vector_push_back<ft_vector>, __BENCH_NO_MAX__},
+	{"Vector", "insert", &vector_insert<std_vector>, &vector_insert<ft_vector>, __BENCH_QUADRATIC_MAX__},
+	{"Vector", "erase", &vector_erase<std_vector>, &vector_erase<ft_vector>, __BENCH_QUADRATIC_MAX__},
+	{"Vector", "iterate", &vector_iterate<std_vector>, &vector_iterate<ft_vector>, __BENCH_NO_MAX__},
+	{"Vector", "copy", &vector_copy<std_vector>, &vector_copy<ft_vector>, __BENCH_NO_MAX__},
+	{"Vector", "clear", &vector_clear<std_vector>, &vector_clear<ft_vector>, __BENCH_NO_MAX__},
+	{"Map", "insert", &map_insert<std_map>, &map_insert<ft_map>, __BENCH_NO_MAX__},
+	{"Map", "append", &map_append<std_map>, &map_append<ft_map>, __BENCH_NO_MAX__},
+	{"Map", "find", &map_find<std_map>, &map_find<ft_map>, __BENCH_NO_MAX__},
+	{"Map", "lower_bound", &map_lower_bound<std_map>, &map_lower_bound<ft_map>, __BENCH_NO_MAX__},
+	{"Map", "erase", &map_erase<std_map>, &map_erase<ft_map>, __BENCH_NO_MAX__},
+	{"Map", "erase_range", &map_erase_range<std_map>, &map_erase_range<ft_map>, __BENCH_NO_MAX__},
+	{"Map", "iterate", &map_iterate<std_map>, &map_iterate<ft_map>, __BENCH_NO_MAX__},
+	{"Map", "copy", &map_copy<std_map>, &map_copy<ft_map>, __BENCH_NO_MAX__},
+	{"Map", "clear", &map_clear<std_map>, &map_clear<ft_map>, __BENCH_NO_MAX__},
+	{"Map", "from_sorted", &map_from_sorted<std_map, std::pair<int, int> >, &map_from_sorted<ft_map, ft::pair<int, int> >, __BENCH_NO_MAX__},
+	{"Map", "scratch", &map_scratch<std_map>, &map_scratch<ft_map>, __BENCH_NO_MAX__},
+	{"Map(pool)", "insert", &map_insert<std_map>, &map_insert<ft_pool_map>, __BENCH_NO_MAX__},
+	{"Map(pool)", "erase", &map_erase<std_map>, &map_erase<ft_pool_map>, __BENCH_NO_MAX__},
+	{"Map(pool)", "copy", &map_copy<std_map>, &map_copy<ft_pool_map>, __BENCH_NO_MAX__},
+	{"Map(pool)", "clear", &map_clear<std_map>, &map_clear<ft_pool_map>, __BENCH_NO_MAX__},
+	{"Map(arena)", "scratch", &map_scratch<std_map>, &map_scratch_arena, __BENCH_NO_MAX__},
+	{"Map(aggregate)", "window_sum", &map_window_sum, &map_window_sum_aggregate, __BENCH_NO_MAX__},
+	{"Stack", "push", &stack_push<std_stack>, &stack_push<ft_stack>, __BENCH_NO_MAX__},
+	{"Stack", "pop", &stack_pop<std_stack>, &stack_pop<ft_stack>, __BENCH_NO_MAX__},
+};
+
+int	main(int argc, char **argv)
+{
+	return (bench::run(g_benchmarks, sizeof(g_benchmarks) / sizeof(*g_benchmarks), argc, argv));
+}
@@ -1,7 +1,40 @@
 #include <iostream>
+#include <cstring>
+#include <sstream>
+#include <iterator>
 #include <map>
 #include <stack>
 #include <vector>
+#include <limits>
+#include <algorithm>
+
+/*
+** stateful comparison object, the order depends on how it's been constructed
+*/
+struct by_direction
+{
+	bool ascending;
+
+	by_direction(bool asc = true) : ascending(asc) {}
+
+	bool operator()(int a, int b) const
+	{
+		return (this->ascending ? a < b : b < a);
+	}
+};
+
+/*
+** sum of the mapped values whose key is in [lo, hi), what Map::aggregate gives
+*/
+static long window_sum(const std::map<int, long> &m, int lo, int hi)
+{
+	long	sum;
+
+	sum = 0;
+	for (std::map<int, long>::const_iterator it = m.lower_bound(lo); lo < hi && it != m.lower_bound(hi); ++it)
+		sum += it->second;
+	return (sum);
+}
 
 int main()
 {
@@ -814,4 +847,409 @@ int main()
 			std::cout << ' ' << *it;
 		std::cout << '\n';
 	}
+	{
+		std::vector<int> myvector;
+
+		for (int i = 0; i < 100; i++)
+			myvector.push_back(i * 3);
+		myvector.reserve(1000);
+
+		std::cout << "myvector contains:";
+		for (unsigned i = 0; i < myvector.size(); i += 9)
+			std::cout << ' ' << myvector[i];
+		std::cout << '\n';
+		std::cout << "size: " << myvector.size() << " capacity: " << myvector.capacity() << '\n';
+	}
+	{
+		std::vector<std::string> myvector(3, "ten");
+		std::vector<std::string>::iterator it;
+
+		it = myvector.begin() + 1;
+		it = myvector.insert(it, "twenty");
+		myvector.insert(it, 2, myvector.back());
+		std::vector<std::string> other(myvector.begin(), myvector.begin() + 3);
+		myvector.insert(myvector.begin() + 2, other.begin(), other.end());
+
+		std::cout << "myvector contains:";
+		for (it = myvector.begin(); it < myvector.end(); it++)
+			std::cout << ' ' << *it;
+		std::cout << '\n';
+	}
+	{
+		std::vector<std::string> myvector;
+
+		for (int i = 0; i < 10; i++)
+			myvector.push_back(std::string(i + 1, 'a' + i));
+		myvector.erase(myvector.begin());
+		myvector.erase(myvector.begin() + 2, myvector.begin() + 5);
+
+		std::cout << "myvector contains:";
+		for (unsigned i = 0; i < myvector.size(); i++)
+			std::cout << ' ' << myvector[i];
+		std::cout << '\n';
+		myvector.clear();
+		std::cout << "size after clear: " << myvector.size() << '\n';
+	}
+	{
+		std::vector<int> foo;
+		std::vector<int> bar(2, 42);
+
+		for (int i = 1; i <= 3; i++)
+			foo.push_back(i * 10);
+		std::cout << "foo size: " << foo.size() << '\n';
+		for (int i = 4; i <= 12; i++)
+			foo.push_back(i * 10);
+		foo.erase(foo.begin() + 1, foo.begin() + 4);
+		foo.insert(foo.begin() + 2, 3, 7);
+		foo.swap(bar);
+
+		std::cout << "foo contains:";
+		for (std::vector<int>::iterator it = foo.begin(); it != foo.end(); ++it)
+			std::cout << ' ' << *it;
+		std::cout << '\n';
+
+		std::cout << "bar contains:";
+		for (std::vector<int>::reverse_iterator it = bar.rbegin(); it != bar.rend(); ++it)
+			std::cout << ' ' << *it;
+		std::cout << '\n';
+
+		std::vector<int> baz(bar);
+		std::cout << "baz == bar: " << (baz == bar) << " baz < foo: " << (baz < foo) << '\n';
+	}
+	{
+		std::istringstream numbers("1 2 3 4 5 6");
+		std::istringstream more("7 8 9");
+		std::vector<int> read((std::istream_iterator<int>(numbers)), std::istream_iterator<int>());
+
+		read.insert(read.begin() + 2, std::istream_iterator<int>(more), std::istream_iterator<int>());
+		std::cout << "read size: " << read.size() << " contains:";
+		for (std::vector<int>::iterator it = read.begin(); it != read.end(); ++it)
+			std::cout << ' ' << *it;
+		std::cout << '\n';
+
+		read.insert(read.begin() + 1, read.begin(), read.end());
+		std::cout << "self insert size: " << read.size() << " contains:";
+		for (std::vector<int>::iterator it = read.begin(); it != read.end(); ++it)
+			std::cout << ' ' << *it;
+		std::cout << '\n';
+
+		read.assign(read.begin() + 3, read.begin() + 7);
+		std::cout << "self assign size: " << read.size() << " contains:";
+		for (std::vector<int>::iterator it = read.begin(); it != read.end(); ++it)
+			std::cout << ' ' << *it;
+		std::cout << '\n';
+	}
+# if __cplusplus >= 201103L
+	{
+		std::vector<std::string> myvector;
+		std::string name("forty-two");
+
+		myvector.emplace_back(3, 'a');
+		myvector.emplace(myvector.begin(), "front");
+		myvector.push_back(std::move(name));
+		myvector.insert(myvector.begin() + 1, std::string("middle"));
+
+		std::cout << "myvector contains:";
+		for (unsigned i = 0; i < myvector.size(); i++)
+			std::cout << ' ' << myvector[i];
+		std::cout << '\n';
+	}
+# endif
+	{
+		std::vector<unsigned char> bytes;
+		const unsigned char chunk[] = {'4', '2', ' ', 'f', 't'};
+
+		for (int i = 0; i < 3; i++)
+		{
+			std::size_t old_size = bytes.size();
+
+			bytes.resize(old_size + 5);
+			std::memcpy(&bytes[old_size], chunk, 5);
+		}
+		bytes.insert(bytes.end(), chunk, chunk + 2);
+		bytes.insert(bytes.end(), bytes.begin(), bytes.begin() + 3);
+		bytes.resize(12);
+
+		std::cout << "bytes contains:";
+		for (unsigned i = 0; i < bytes.size(); i++)
+			std::cout << ' ' << bytes[i];
+		std::cout << '\n';
+
+		std::vector<std::string> words;
+		const std::string src[] = {"read", "decode", "append"};
+
+		words.insert(words.end(), src, src + 3);
+		words.resize(words.size() + 2);
+		std::cout << "words size: " << words.size() << " last: [" << words.back() << "]\n";
+	}
+	{
+		std::vector<int> myvector;
+		const int values[] = {10, 20, 30, 40, 50};
+		std::istringstream input("1 2 3");
+
+		myvector.assign(values, values + 5);
+		myvector.insert(myvector.begin() + 2, std::istream_iterator<int>(input), std::istream_iterator<int>());
+		myvector.insert(myvector.end(), values, values + 2);
+
+		std::cout << "myvector contains:";
+		for (unsigned i = 0; i < myvector.size(); i++)
+			std::cout << ' ' << myvector[i];
+		std::cout << '\n';
+	}
+	{
+		std::map<int, char, by_direction> descending(by_direction(false));
+
+		for (int i = 0; i < 5; i++)
+			descending.insert(std::make_pair(i, 'a' + i));
+		descending.erase(2);
+
+		std::cout << "descending contains:";
+		for (std::map<int, char, by_direction>::iterator it = descending.begin(); it != descending.end(); ++it)
+			std::cout << ' ' << it->first << it->second;
+		std::cout << " lower_bound(2): " << descending.lower_bound(2)->first << '\n';
+	}
+	{
+		std::map<std::string, int> words;
+		const char *text[] = {"pear", "apple", "fig", "apple", "kiwi", "fig", "apple"};
+
+		for (int i = 0; i < 7; i++)
+			++words[text[i]];
+		words.erase("kiwi");
+
+		std::cout << "words contains:";
+		for (std::map<std::string, int>::iterator it = words.begin(); it != words.end(); ++it)
+			std::cout << ' ' << it->first << '=' << it->second;
+		std::cout << " count(fig): " << words.count("fig") << " count(kiwi): " << words.count("kiwi") << '\n';
+	}
+	{
+		typedef std::map<int, std::string> pool_map;
+		pool_map first;
+		std::ostringstream name;
+
+		for (int i = 0; i < 100; i++)
+		{
+			name.str("");
+			name << 'n' << i;
+			first[i] = name.str();
+		}
+		for (int i = 0; i < 100; i += 2)
+			first.erase(i);
+		for (int i = 100; i < 140; i += 4)
+			first.insert(std::make_pair(i, std::string("again")));
+
+		pool_map second(first);
+		pool_map third;
+
+		second.erase(second.begin(), second.find(91));
+		third = second;
+		third.swap(first);
+		first.clear();
+		first[7] = "seven";
+
+		std::cout << "pool first size: " << first.size() << " [" << first[7] << "]\n";
+		std::cout << "pool second size: " << second.size() << " third size: " << third.size() << '\n';
+		std::cout << "pool third contains:";
+		for (pool_map::iterator it = third.begin(); it != third.end(); ++it)
+			std::cout << ' ' << it->first << '=' << it->second;
+		std::cout << '\n';
+	}
+	{
+		std::allocator<int>		ints;
+		std::allocator<double>	doubles(ints);
+		std::allocator<int>		back(doubles);
+		int				*block;
+
+		block = ints.allocate(1);
+		*block = 42;
+		std::cout << "pool rebind equal: " << (ints == doubles) << ' ' << (back == ints) << " value: " << *block << '\n';
+		back.deallocate(block, 1);
+	}
+	{
+		typedef std::map<int, int> arena_map;
+		typedef std::map<int, std::string> arena_names;
+
+		for (int round = 0; round < 3; round++)
+		{
+			{
+				arena_map squares;
+				arena_names names;
+
+				for (int i = 0; i < 50 * (round + 1); i++)
+					squares[i] = i * i;
+				squares.erase(10);
+				names[round] = "round";
+				names[round + 1] = std::string(40, 'x');
+
+				arena_map copy(squares);
+
+				copy.clear();
+				copy[3] = 9;
+				names.clear();
+				std::cout << "arena round " << round << ": " << squares.size() << ' ' << squares.rbegin()->second
+					<< ' ' << squares.count(10) << " copy: " << copy.size() << " names: " << names.size() << '\n';
+			}
+		}
+	}
+	{
+		std::map<int, std::string> config;
+		const char *values[] = {"alpha", "beta", "gamma", "delta", "epsilon", "zeta", "eta"};
+
+		for (int i = 0; i < 7; i++)
+			config[i * 3] = values[i];
+
+		std::map<int, std::string> snapshot(config);
+		std::map<int, std::string> &same = snapshot;
+
+		snapshot = same;
+		config.erase(9);
+		config[4] = "four";
+		snapshot[18] = "theta";
+
+		std::cout << "config contains:";
+		for (std::map<int, std::string>::iterator it = config.begin(); it != config.end(); ++it)
+			std::cout << ' ' << it->first << '=' << it->second;
+		std::cout << "\nsnapshot contains:";
+		for (std::map<int, std::string>::reverse_iterator it = snapshot.rbegin(); it != snapshot.rend(); ++it)
+			std::cout << ' ' << it->first << '=' << it->second;
+		std::cout << " lower_bound(10): " << snapshot.lower_bound(10)->first << '\n';
+	}
+	{
+		std::vector<std::pair<int, char> > snapshot;
+
+		for (int i = 0; i < 26; i++)
+			snapshot.push_back(std::make_pair(i * 10, 'a' + i));
+
+		std::map<int, char> loaded(snapshot.begin(), snapshot.end());
+		std::map<int, char> checked(snapshot.begin(), snapshot.begin() + 10);
+
+		snapshot[5].first = 7;
+		snapshot.push_back(std::make_pair(30, 'z'));
+
+		std::map<int, char> unsorted(snapshot.begin(), snapshot.end());
+
+		loaded.erase(120);
+		loaded[125] = '!';
+		std::cout << "loaded size: " << loaded.size() << " [" << loaded.begin()->second << loaded.rbegin()->second
+			<< "] lower_bound(121): " << loaded.lower_bound(121)->first << '\n';
+		std::cout << "checked contains:";
+		for (std::map<int, char>::iterator it = checked.begin(); it != checked.end(); ++it)
+			std::cout << ' ' << it->first << it->second;
+		std::cout << "\nunsorted size: " << unsorted.size() << " contains:";
+		for (std::map<int, char>::iterator it = unsorted.begin(); it != unsorted.find(60); ++it)
+			std::cout << ' ' << it->first << it->second;
+		std::cout << '\n';
+	}
+	{
+		std::map<int, double> series;
+		std::map<int, double>::iterator last;
+
+		for (int t = 0; t < 20; t++)
+			last = series.insert(series.end(), std::make_pair(t * 5, t * 0.5));
+		last = series.insert(series.begin(), std::make_pair(-5, -1.0));
+		last = series.insert(series.find(50), std::make_pair(47, 4.7));
+		last = series.insert(series.find(50), std::make_pair(50, 0.0));
+		std::cout << "hinted existing: " << last->first << '=' << last->second;
+		last = series.insert(series.begin(), std::make_pair(93, 9.3));
+		std::cout << " wrong hint: " << last->first << '=' << last->second << " size: " << series.size() << '\n';
+		std::cout << "series contains:";
+		for (std::map<int, double>::iterator it = series.begin(); it != series.end(); ++it)
+			std::cout << ' ' << it->first << '=' << it->second;
+		std::cout << '\n';
+	}
+	{
+		std::map<int, std::string> sessions;
+
+		for (int i = 0; i < 16; i++)
+			sessions[i] = std::string(i + 1, 'a' + i);
+
+		std::map<int, std::string>::iterator kept = sessions.find(8);
+		std::map<int, std::string>::iterator next = sessions.find(4);
+
+		sessions.erase(sessions.find(7));
+		sessions.erase(sessions.begin());
+		sessions.erase(next++);
+		sessions.erase(next, sessions.find(6));
+		for (std::map<int, std::string>::iterator it = sessions.begin(); it != sessions.end();)
+		{
+			if (it->first % 3 == 0)
+				sessions.erase(it++);
+			else
+				++it;
+		}
+		std::cout << "kept: " << kept->first << '=' << kept->second << " size: " << sessions.size() << '\n';
+		std::cout << "sessions contains:";
+		for (std::map<int, std::string>::iterator it = sessions.begin(); it != sessions.end(); ++it)
+			std::cout << ' ' << it->first << '=' << it->second.size();
+		std::cout << '\n';
+	}
+	{
+		std::map<int, int> window;
+
+		for (int t = 0; t < 1000; t++)
+			window[t] = t % 7;
+		window.erase(window.lower_bound(100), window.lower_bound(900));
+		window.erase(window.find(95), window.find(905));
+		window.erase(window.lower_bound(990), window.end());
+		window.erase(window.begin(), window.upper_bound(3));
+		window.erase(window.find(50), window.find(50));
+
+		int sum = 0;
+		for (std::map<int, int>::iterator it = window.begin(); it != window.end(); ++it)
+			sum += it->second;
+		std::cout << "window size: " << window.size() << " sum: " << sum << " first: " << window.begin()->first
+			<< " around 100: " << (--window.lower_bound(100))->first << ' ' << window.lower_bound(100)->first
+			<< " last: " << window.rbegin()->first << '\n';
+	}
+	{
+		typedef std::map<int, std::string> leaderboard;
+		leaderboard scores;
+		const char *players[] = {"ana", "bo", "cy", "dee", "eli", "fay", "gus", "hal", "ivy", "jo"};
+
+		for (int i = 0; i < 10; i++)
+			scores[(i * 37) % 101] = players[i];
+		scores.erase(74);
+		scores.erase(scores.find(10), scores.find(37));
+
+		leaderboard::iterator median = scores.begin();
+
+		std::advance(median, scores.size() / 2);
+		std::cout << "median: " << median->second
+			<< " rank(50): " << std::distance(scores.begin(), scores.lower_bound(50))
+			<< " rank(93): " << std::distance(scores.begin(), scores.lower_bound(93))
+			<< " count_range(10, 90): " << std::distance(scores.lower_bound(10), scores.lower_bound(90))
+			<< " count_range(90, 10): " << 0 << '\n';
+		std::cout << "ranked:";
+		std::size_t k = 0;
+		for (leaderboard::iterator it = scores.begin(); it != scores.end(); ++it, ++k)
+			std::cout << ' ' << k << ':' << it->first;
+		std::cout << " out of range: " << 1 << '\n';
+	}
+	{
+		std::cout << "\n=============== AGGREGATE ===============\n";
+		typedef std::map<int, long> metrics;
+		metrics latency;
+
+		for (int i = 0; i < 40; i++)
+			latency.insert(std::make_pair((i * 13) % 97, static_cast<long>((i * 29) % 53 - 10)));
+		latency.erase(latency.find(26), latency.find(65));
+		latency[91] += 100;
+		std::cout << "before update: " << window_sum(latency, 0, 97) << " [10, 20): " << window_sum(latency, 10, 20) << '\n';
+		latency[96] += 5;
+		latency[13] += 7;
+		latency[20] = -latency[20];
+		std::cout << "after update: " << window_sum(latency, 0, 97) << " [10, 20): " << window_sum(latency, 10, 20)
+			<< " [10, 21): " << window_sum(latency, 10, 21) << '\n';
+
+		int ranges[][2] = {{0, 97}, {10, 50}, {65, 66}, {30, 60}, {50, 10}};
+		for (int r = 0; r < 5; r++)
+		{
+			long sum = 0, lo = std::numeric_limits<long>::max();
+			for (metrics::iterator it = latency.lower_bound(ranges[r][0]); ranges[r][0] < ranges[r][1] && it != latency.lower_bound(ranges[r][1]); ++it)
+			{
+				sum += it->second;
+				lo = std::min(lo, it->second);
+			}
+			std::cout << '[' << ranges[r][0] << ", " << ranges[r][1] << ") sum: " << sum << " min: " << lo << '\n';
+		}
+	}
 }
\ No newline at end of file
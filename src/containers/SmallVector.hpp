@@ -0,0 +1,776 @@
+/*
+** SMALL VECTOR:
+** A SmallVector is a Vector that keeps up to N (at least 1) elements inside the object itself,
+** in a buffer that is part of the SmallVector (on the stack for a local variable).
+** As long as its size stays under N, no allocation happens at all.
+** When it needs more room, it spills its elements to a buffer allocated with its allocator,
+** and from there, it behaves exactly like a Vector (growth policy included).
+**
+** It offers the same interface as ft::Vector, the only differences are:
+**     - the initial capacity is N instead of 0
+**     - swapping two SmallVectors may need to copy the elements if one of them is using its inline buffer,
+**       so the iterators aren't guaranteed to remain valid after a swap.
+**
+** It's meant for short lived sequences that are small most of the time
+** (e.g. the arguments of a request), where the cost of the allocation dominates.
+*/
+
+# pragma once
+
+# include <memory>
+# include <cstddef>
+# include <algorithm>
+# include "../Utility/Iterators/random_access_iterator.hpp"
+# include "../Utility/Iterators/reverse_iterator.hpp"
+# include "../Utility/enable_if.hpp"
+# include "../Utility/is_integral.hpp"
+# include "../Utility/algorithms.hpp"
+# include "../Utility/uninitialized.hpp"
+# include "../Utility/growth_policy.hpp"
+# include "../Utility/alignment.hpp"
+
+# include <stdexcept>
+
+namespace ft
+{
+
+template <
+	class T,
+	std::size_t N,
+	class Alloc = std::allocator<T>,
+	class Growth = ft::growth_double
+	>
+class SmallVector
+{
+	/* ============================== MEMBER TYPE ============================== */
+	public:
+		typedef T														value_type;
+		typedef Alloc													allocator_type;
+		typedef Growth													growth_policy;
+
+		typedef typename allocator_type::reference						reference;
+		typedef typename allocator_type::const_reference				const_reference;
+		typedef typename allocator_type::pointer						pointer;
+		typedef typename allocator_type::const_pointer					const_pointer;
+
+		typedef typename ft::random_access_iterator<value_type>			iterator;
+		typedef typename ft::random_access_iterator<const value_type>	const_iterator;
+
+		typedef typename ft::reverse_iterator<iterator>					reverse_iterator;
+		typedef typename ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+
+		typedef typename allocator_type::difference_type				difference_type;
+		typedef typename allocator_type::size_type						size_type;
+
+	/* ============================== MEMBER ATTRIBUTES ============================== */
+	private:
+		/*
+		** the inline storage, ft::max_align is only there to align it (C++98 has no alignas):
+		** it has the strictest fundamental alignment, so it suits any T that isn't over-aligned
+		*/
+		union inline_buffer
+		{
+			char			bytes[sizeof(T) * N];
+			ft::max_align	align;
+		};
+
+		/*
+		** an over-aligned T (alignment beyond ft::max_align) can't be stored inline:
+		** the size of this array is negative for such a type, so it doesn't compile
+		*/
+		typedef char	inline_buffer_alignment_check[(__FT_ALIGNOF__(T) <= __FT_ALIGNOF__(ft::max_align)) ? 1 : -1];
+
+		value_type		*_v;
+		size_type		_capacity;
+		size_type		_size;
+		allocator_type	_alloc;
+		inline_buffer	_buffer;
+
+	/* ============================== CONSTRUCTORS/DESTRUCTOR ============================== */
+	public:
+		/*
+		** empty container constructor (default constructor)
+		** Constructs an empty container, with no elements, using the inline buffer.
+		** @param alloc Allocator object.
+		*/
+		explicit SmallVector(const allocator_type& alloc = allocator_type())
+		: _v(_inline()), _capacity(N), _size(0), _alloc(alloc)
+		{
+		}
+
+		/*
+		** fill constructor
+		** Constructs a container with n elements. Each element is a copy of val.
+		** @param n Initial container size
+		** @param val Value to fill the container with
+		** @param alloc Allocator object.
+		*/
+		explicit SmallVector(size_type n, const value_type& val = value_type(),
+			const allocator_type& alloc = allocator_type())
+		: _v(_inline()), _capacity(N), _size(0), _alloc(alloc)
+		{
+			this->assign(n, val);
+		}
+
+		/*
+		** range constructor
+		** Constructs a container with as many elements as the range [first,last),
+		** with each element constructed from its corresponding element in that range, in the same order.
+		** @param first Input iterators to the initial positions in a range
+		** @param last Input iterators to the final positions in a range
+		** @param alloc Allocator object.
+		*/
+		template <class InputIterator>
+		SmallVector(InputIterator first, InputIterator last,
+			const allocator_type& alloc = allocator_type(),
+			typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type = InputIterator())
+		: _v(_inline()), _capacity(N), _size(0), _alloc(alloc)
+		{
+			this->assign(first, last);
+		}
+
+		SmallVector(const SmallVector& x)
+		: _v(_inline()), _capacity(N), _size(0), _alloc(x.get_allocator())
+		{
+			this->assign(x.begin(), x.end());
+		}
+
+		/*
+		** This destroys all container elements, and deallocates
+		** the heap storage if the elements have been spilled.
+		*/
+		~SmallVector(void)
+		{
+			this->clear();
+			this->_release();
+		}
+
+		/* ============================== MEMBER FUNCTIONS ============================== */
+		/* =================== */
+		/* ==== ITERATORS ==== */
+		/* =================== */
+		iterator begin()
+		{
+			return (iterator(this->_v));
+		}
+
+		const_iterator begin() const
+		{
+			return (const_iterator(this->_v));
+		}
+
+		iterator end()
+		{
+			return (iterator(this->_v + this->size()));
+		}
+
+		const_iterator end() const
+		{
+			return (const_iterator(this->_v + this->size()));
+		}
+
+		reverse_iterator rbegin()
+		{
+			return (reverse_iterator(this->end()));
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return (const_reverse_iterator(this->end()));
+		}
+
+		reverse_iterator rend()
+		{
+			return (reverse_iterator(this->begin()));
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return (const_reverse_iterator(this->begin()));
+		}
+
+		/* ================== */
+		/* ==== CAPACITY ==== */
+		/* ================== */
+		size_type size() const
+		{
+			return (this->_size);
+		}
+
+		/*
+		** Returns the size of the storage space currently available, which is N as long
+		** as the elements fit in the inline buffer.
+		** @param void void
+		** @return The size of the current storage capacity, measured in terms of the number elements it can hold.
+		*/
+		size_type capacity() const
+		{
+			return (this->_capacity);
+		}
+
+		size_type max_size() const
+		{
+			return (this->_alloc.max_size());
+		}
+
+		/*
+		** Test whether the elements are stored in the inline buffer
+		** @param void void
+		** @return true if no heap storage is used, otherwise false
+		*/
+		bool is_inline() const
+		{
+			return (this->_v == this->_inline());
+		}
+
+		/*
+		** Change size
+		** Resizes the container so that it contains n elements, removing the elements
+		** beyond n or appending copies of val.
+		** @param n New container size, expressed in number of elements.
+		** @param val Object whose content is copied to the added elements in case that n is greater than the current container size.
+		** @return void
+		*/
+		void resize(size_type n, value_type val = value_type())
+		{
+			if (n < this->size())
+			{
+				this->erase(this->begin() + n, this->end());
+				return ;
+			}
+			this->reserve(n);
+			for (; this->_size < n; ++this->_size)
+				this->_alloc.construct(this->_v + this->_size, val);
+		}
+
+		bool empty() const
+		{
+			return (this->size() == 0);
+		}
+
+		/*
+		** Request a change in capacity
+		** If n is greater than the current capacity, the elements are moved
+		** to a heap buffer able to hold n elements.
+		** @param n Minimum capacity for the SmallVector.
+		** @return void
+		*/
+		void reserve (size_type n)
+		{
+			value_type	*tmp;
+
+			if (n <= this->capacity())
+				return ;
+			tmp = this->_alloc.allocate(n);
+			ft::uninitialized_relocate(this->_alloc, this->_v, this->_v + this->size(), tmp);
+			this->_release();
+			this->_v = tmp;
+			this->_capacity = n;
+		}
+
+		/* ======================== */
+		/* ==== ELEMENT ACCESS ==== */
+		/* ======================== */
+		reference operator[] (size_type n)
+		{
+			return (this->_v[n]);
+		}
+
+		const_reference operator[] (size_type n) const
+		{
+			return (this->_v[n]);
+		}
+
+		reference at (size_type n)
+		{
+			if (n >= this->size())
+				throw std::out_of_range("oh boy, it's out of range exception, newbie :(");
+			return (this->_v[n]);
+		}
+
+		const_reference at (size_type n) const
+		{
+			if (n >= this->size())
+				throw std::out_of_range("oh boy, it's out of range exception, newbie :(");
+			return (this->_v[n]);
+		}
+
+		reference front()
+		{
+			return (*(this->_v));
+		}
+
+		const_reference front() const
+		{
+			return (*(this->_v));
+		}
+
+		reference back()
+		{
+			return (this->_v[this->size() - 1]);
+		}
+
+		const_reference back() const
+		{
+			return (this->_v[this->size() - 1]);
+		}
+
+		/* ======================= */
+		/* ====== MODIFIERS ====== */
+		/* ======================= */
+		/*
+		** Assigns new contents to the SmallVector, the new contents are
+		** copies of the elements in the range [first, last).
+		** Forward iterators are measured first so the storage grows at most once,
+		** input iterators (that can be walked only once) are appended one by one.
+		** The range may be made of elements of the SmallVector itself.
+		** @param first Input iterators to the initial positions in a sequence
+		** @param last Input iterators to the final positions in a sequence
+		** @return void
+		*/
+		template <class InputIterator>
+		void assign (
+				InputIterator first,
+				InputIterator last,
+				typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type = InputIterator()
+				)
+		{
+			this->_assign_range(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		/*
+		** Assigns new contents to the SmallVector, n copies of val.
+		** @param n New size for the container.
+		** @param val Value to fill the container with.
+		** @return void
+		*/
+		void assign (size_type n, const value_type& val)
+		{
+			if (this->_is_inside(val))
+			{
+				this->assign(n, value_type(val));
+				return ;
+			}
+			this->clear();
+			this->_grow(n, 0);
+			for (; this->_size < n; ++this->_size)
+				this->_alloc.construct(this->_v + this->_size, val);
+		}
+
+		/*
+		** Adds a new element at the end, spilling to the heap if the inline buffer is full.
+		** @param val Value to be copied to the new element.
+		** @return void
+		*/
+		void push_back (const value_type& val)
+		{
+			if (this->size() == this->capacity() && this->_is_inside(val))
+			{
+				this->push_back(value_type(val));
+				return ;
+			}
+			this->_grow(this->size() + 1, this->capacity());
+			this->_alloc.construct(this->_v + this->_size++, val);
+		}
+
+		void pop_back()
+		{
+			if (!this->size())
+				return ;
+			this->_alloc.destroy(this->_v + --this->_size);
+		}
+
+		/*
+		** Insert elements
+		** Inserts val before position.
+		** @param position Position where the new element is inserted.
+		** @param val Value to be copied to the inserted element.
+		** @return An iterator that points to the newly inserted element.
+		*/
+		iterator insert (iterator position, const value_type& val)
+		{
+			size_type pos;
+
+			if (this->_is_inside(val))
+				return (this->insert(position, value_type(val)));
+			pos = this->_prepare_insert(position, 1);
+			this->_alloc.construct(this->_v + pos, val);
+			++this->_size;
+			return (iterator(this->_v + pos));
+		}
+
+		/*
+		** Insert elements
+		** Inserts n copies of val before position.
+		** @param position Position where the new elements are inserted.
+		** @param n Number of elements to insert.
+		** @param val Value to be copied to the inserted elements.
+		** @return void
+		*/
+		void insert (iterator position, size_type n, const value_type& val)
+		{
+			size_type pos;
+
+			if (this->_is_inside(val))
+			{
+				this->insert(position, n, value_type(val));
+				return ;
+			}
+			pos = this->_prepare_insert(position, n);
+			for (size_type i = 0; i < n; i++)
+				this->_alloc.construct(this->_v + pos + i, val);
+			this->_size += n;
+		}
+
+		/*
+		** Insert elements
+		** Inserts copies of the elements in the range [first,last) before position.
+		** The range may be made of elements of the SmallVector itself.
+		** @param position Position where the new elements are inserted.
+		** @param first Iterators specifying a range of elements.
+		** @param last Iterators specifying a range of elements.
+		** @return void
+		*/
+		template <class InputIterator>
+		void insert (
+					iterator position,
+					InputIterator first,
+					InputIterator last,
+					typename ft::enable_if<!(ft::is_integral<InputIterator>::value), InputIterator>::type = InputIterator()
+					)
+		{
+			this->_insert_range(position, first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
+		}
+
+		/*
+		** Erase elements
+		** Removes a single element.
+		** @param position Iterator pointing to a single element to be removed.
+		** @return An iterator pointing to the new location of the element that followed the element erased
+		*/
+		iterator erase (iterator position)
+		{
+			return (this->erase(position, position + 1));
+		}
+
+		/*
+		** Erase elements
+		** Removes the range of elements [first,last).
+		** @param first Iterators specifying a range to be removed: [first,last)
+		** @param last Iterators specifying a range to be removed: [first,last)
+		** @return An iterator pointing to the new location of the element that followed the last element erased
+		*/
+		iterator erase (iterator first, iterator last)
+		{
+			value_type	*end;
+
+			end = ft::erase_shift_left(this->_alloc, first.base(), last.base(), this->_v + this->size());
+			this->_size = end - this->_v;
+			return (first);
+		}
+
+		/*
+		** Swap content
+		** When both containers are using heap storage, only the buffers are exchanged,
+		** otherwise the elements are copied.
+		** @param x Another SmallVector of the same type
+		** @return void
+		*/
+		void swap (SmallVector& x)
+		{
+			if (this == &x)
+				return ;
+			if (!this->is_inline() && !x.is_inline())
+			{
+				std::swap(this->_v, x._v);
+				std::swap(this->_capacity, x._capacity);
+				std::swap(this->_size, x._size);
+				std::swap(this->_alloc, x._alloc);
+				return ;
+			}
+
+			SmallVector	tmp(x);
+
+			x = *this;
+			*this = tmp;
+		}
+
+		/*
+		** Clear content
+		** Removes all elements, the storage (inline or not) is kept.
+		** @param void void
+		** @return void
+		*/
+		void clear()
+		{
+			for (size_type i = 0; i < this->size(); i++)
+				this->_alloc.destroy(this->_v + i);
+			this->_size = 0;
+		}
+
+		/* ======================== */
+		/* ======= ALLOATOR ======= */
+		/* ======================== */
+		allocator_type get_allocator() const
+		{
+			return (this->_alloc);
+		}
+
+		/* ============================== OPERATORS ============================== */
+		/*
+		** Copies all the elements from x into the container, the storage
+		** is reused if it's big enough.
+		** @param x A SmallVector object of the same type
+		** @return *this
+		*/
+		SmallVector& operator= (const SmallVector& x)
+		{
+			if (this == &x)
+				return (*this);
+			this->assign(x.begin(), x.end());
+			return (*this);
+		}
+
+		/* ============================== HELPER FUNCTIONS ============================== */
+		private:
+			value_type	*_inline()
+			{
+				return (reinterpret_cast<value_type *>(this->_buffer.bytes));
+			}
+
+			const value_type	*_inline() const
+			{
+				return (reinterpret_cast<const value_type *>(this->_buffer.bytes));
+			}
+
+			/*
+			** give the heap storage back to the allocator, if any
+			** @param void void
+			** @return void
+			*/
+			void	_release()
+			{
+				if (!this->is_inline())
+					this->_alloc.deallocate(this->_v, this->capacity());
+			}
+
+			/*
+			** assign for input iterators, the range can be walked only once
+			** so its elements are appended one by one
+			** @param first Input iterators to the initial positions in a sequence
+			** @param last Input iterators to the final positions in a sequence
+			** @return void
+			*/
+			template <class InputIterator>
+			void	_assign_range(InputIterator first, InputIterator last, std::input_iterator_tag)
+			{
+				this->clear();
+				for (; first != last; ++first)
+					this->push_back(*first);
+			}
+
+			/*
+			** assign for forward iterators, the storage grows at most once.
+			** A range of our own elements would be destroyed by clear() before being read:
+			** it's copied to a temporary SmallVector first.
+			** @param first Forward iterators to the initial positions in a sequence
+			** @param last Forward iterators to the final positions in a sequence
+			** @return void
+			*/
+			template <class ForwardIterator>
+			void	_assign_range(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+			{
+				size_type	n;
+
+				if (first != last && this->_is_inside(*first))
+				{
+					SmallVector tmp(first, last, this->_alloc);
+
+					this->clear();
+					this->_relocate_from(this->begin(), tmp);
+					return ;
+				}
+				n = std::distance(first, last);
+				this->clear();
+				this->_grow(n, 0);
+				ft::uninitialized_copy(this->_alloc, first, last, this->_v);
+				this->_size = n;
+			}
+
+			/*
+			** insert for input iterators, the range can be walked only once:
+			** at the end, its elements are appended one by one, elsewhere they're first
+			** gathered in a temporary SmallVector and then relocated into a single gap
+			** @param position Position where the new elements are inserted.
+			** @param first Input iterators to the initial positions in a sequence
+			** @param last Input iterators to the final positions in a sequence
+			** @return void
+			*/
+			template <class InputIterator>
+			void	_insert_range(iterator position, InputIterator first, InputIterator last, std::input_iterator_tag)
+			{
+				if (position == this->end())
+				{
+					for (; first != last; ++first)
+						this->push_back(*first);
+					return ;
+				}
+				SmallVector tmp(first, last, this->_alloc);
+
+				this->_relocate_from(position, tmp);
+			}
+
+			/*
+			** insert for forward iterators, the gap is opened once.
+			** Opening the gap moves (or frees) our own elements,
+			** so a range made of them is copied to a temporary SmallVector first.
+			** @param position Position where the new elements are inserted.
+			** @param first Forward iterators to the initial positions in a sequence
+			** @param last Forward iterators to the final positions in a sequence
+			** @return void
+			*/
+			template <class ForwardIterator>
+			void	_insert_range(iterator position, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+			{
+				size_type	pos;
+				size_type	n;
+
+				if (first != last && this->_is_inside(*first))
+				{
+					SmallVector tmp(first, last, this->_alloc);
+
+					this->_relocate_from(position, tmp);
+					return ;
+				}
+				n = std::distance(first, last);
+				pos = this->_prepare_insert(position, n);
+				ft::uninitialized_copy(this->_alloc, first, last, this->_v + pos);
+				this->_size += n;
+			}
+
+			/*
+			** move all the elements of tmp into a single gap before position, tmp is left empty
+			** @param position Position where the elements are inserted.
+			** @param tmp the elements to insert
+			** @return void
+			*/
+			void	_relocate_from(iterator position, SmallVector &tmp)
+			{
+				size_type	pos;
+
+				pos = this->_prepare_insert(position, tmp.size());
+				ft::uninitialized_relocate(this->_alloc, tmp._v, tmp._v + tmp.size(), this->_v + pos);
+				this->_size += tmp.size();
+				tmp._size = 0;
+			}
+
+			/*
+			** check if val is one of the elements of the SmallVector
+			** @param val the value to check
+			** @return true if val is stored in [begin, end), otherwise false
+			*/
+			bool	_is_inside(const value_type &val) const
+			{
+				return (this->size() && &val >= this->_v && &val < this->_v + this->size());
+			}
+
+			/*
+			** Make sure the storage can hold at least n elements,
+			** the new capacity is chosen by the growth policy
+			** @param n number of elements the storage must be able to hold
+			** @param from capacity the policy grows from (0 when the current content is discarded)
+			** @return void
+			*/
+			void	_grow(size_type n, size_type from)
+			{
+				if (n <= this->capacity())
+					return ;
+				this->reserve(Growth::template next_capacity<value_type>(from, n));
+			}
+
+			/*
+			** Open a gap of n uninitialized slots before position (see Vector::_prepare_insert)
+			** @param position Position where the new elements are inserted.
+			** @param n Number of elements to insert.
+			** @return the index of the first slot of the gap
+			*/
+			size_type _prepare_insert (iterator position, size_type n)
+			{
+				size_type	pos;
+				size_type	new_capacity;
+				value_type	*tmp;
+
+				pos = position.base() - this->_v;
+				if (this->size() + n > this->capacity())
+				{
+					new_capacity = Growth::template next_capacity<value_type>(this->capacity(), this->size() + n);
+					tmp = this->_alloc.allocate(new_capacity);
+					ft::uninitialized_relocate(this->_alloc, this->_v, this->_v + pos, tmp);
+					ft::uninitialized_relocate(this->_alloc, this->_v + pos, this->_v + this->size(), tmp + pos + n);
+					this->_release();
+					this->_v = tmp;
+					this->_capacity = new_capacity;
+					return (pos);
+				}
+				ft::uninitialized_shift_right(this->_alloc, this->_v + pos, this->_v + this->size(), n);
+				return (pos);
+			}
+};
+
+/*
+** a SmallVector without an inline buffer is a Vector (and its buffer would be a zero-size array):
+** left undefined, so SmallVector<T, 0> doesn't compile, use ft::Vector instead
+*/
+template <class T, class Alloc, class Growth>
+class SmallVector<T, 0, Alloc, Growth>;
+
+
+/* ============================== NON-FUNCTIONS MEMBER FUNCTION OVERLOADS ============================== */
+template <class T, std::size_t N, class Alloc, class Growth>
+void swap (SmallVector<T,N,Alloc,Growth>& x, SmallVector<T,N,Alloc,Growth>& y)
+{
+	x.swap(y);
+}
+
+/* ============================== RELATIONAL OPERATORS ============================== */
+template <class T, std::size_t N, class Alloc, class Growth>
+bool operator== (const SmallVector<T,N,Alloc,Growth>& lhs, const SmallVector<T,N,Alloc,Growth>& rhs)
+{
+	if (lhs.size() != rhs.size())
+		return (false);
+	return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template <class T, std::size_t N, class Alloc, class Growth>
+bool operator!= (const SmallVector<T,N,Alloc,Growth>& lhs, const SmallVector<T,N,Alloc,Growth>& rhs)
+{
+	return !(lhs == rhs);
+}
+
+template <class T, std::size_t N, class Alloc, class Growth>
+bool operator<  (const SmallVector<T,N,Alloc,Growth>& lhs, const SmallVector<T,N,Alloc,Growth>& rhs)
+{
+	return (ft::lexicographical_compare(
+			lhs.begin(),lhs.end(),
+			rhs.begin(), rhs.end()));
+}
+
+template <class T, std::size_t N, class Alloc, class Growth>
+bool operator<= (const SmallVector<T,N,Alloc,Growth>& lhs, const SmallVector<T,N,Alloc,Growth>& rhs)
+{
+	return (!(rhs < lhs));
+}
+
+template <class T, std::size_t N, class Alloc, class Growth>
+bool operator>  (const SmallVector<T,N,Alloc,Growth>& lhs, const SmallVector<T,N,Alloc,Growth>& rhs)
+{
+	return (rhs < lhs);
+}
+
+template <class T, std::size_t N, class Alloc, class Growth>
+bool operator>= (const SmallVector<T,N,Alloc,Growth>& lhs, const SmallVector<T,N,Alloc,Growth>& rhs)
+{
+	return (!(rhs > lhs));
+}
+
+};
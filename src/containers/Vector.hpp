@@ -36,22 +36,27 @@
 # pragma once
 
 # include <memory>
+# include <cstring>
 # include "../Utility/Iterators/random_access_iterator.hpp"
 # include "../Utility/Iterators/reverse_iterator.hpp"
 # include "../Utility/enable_if.hpp"
 # include "../Utility/is_integral.hpp"
 # include "../Utility/comparison_helper_functions.hpp"
 # include "../Utility/algorithms.hpp"
+# include "../Utility/uninitialized.hpp"
+# include "../Utility/is_trivially_default_constructible.hpp"
+# include "../Utility/allocator_reallocate.hpp"
+# include "../Utility/growth_policy.hpp"
+# include "../Utility/move.hpp"
 
 # include <stdexcept>
 
-# define __VECTOR_GROWTH_SIZE__ 2
 # define __EPSILON_SIZE__ 1
 
 namespace ft
 {
 
-template < class T, class Alloc = std::allocator<T> >
+template < class T, class Alloc = std::allocator<T>, class Growth = ft::growth_double >
 class Vector
 {
 	/* ============================== MEMBER TYPE ============================== */
@@ -62,6 +67,9 @@ class Vector
 		/* 	The second template parameter (Alloc) */
 		typedef Alloc													allocator_type;
 
+		/* 	The third template parameter (Growth), see growth_policy.hpp */
+		typedef Growth													growth_policy;
+
 		typedef typename allocator_type::reference						reference;
 		typedef typename allocator_type::const_reference				const_reference;
 		typedef typename allocator_type::pointer						pointer;
@@ -130,18 +138,33 @@ class Vector
         Vector(InputIterator first, InputIterator last,
             const allocator_type& alloc = allocator_type(),
 			typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type = InputIterator())
-		: _capacity(0), _size(0), _alloc(alloc)
+		: _v(nullptr), _capacity(0), _size(0), _alloc(alloc)
 		{
-			this->_size = 0;
 			this->assign(first, last);
 		}
 
 		Vector(const Vector& x)
-        : _capacity(0), _size(0), _alloc(x.get_allocator())
+        : _v(nullptr), _capacity(0), _size(0), _alloc(x.get_allocator())
 		{
 			(*this) = x;
 		}
 
+# if __FT_CXX11__
+		/*
+		** move constructor (C++11)
+		** Steals the storage of x, which is left empty.
+		** @param x A Vector object of the same type
+		** @return none none
+		*/
+		Vector(Vector&& x)
+        : _v(x._v), _capacity(x._capacity), _size(x._size), _alloc(x._alloc)
+		{
+			x._v = nullptr;
+			x._capacity = 0;
+			x._size = 0;
+		}
+# endif
+
 		/*
 		** This destroys all container elements, and deallocates
 		** all the storage capacity allocated by the Vector using its allocator.
@@ -379,6 +402,27 @@ class Vector
 			this->_size = n;
 		}
 
+		/*
+		** Change size, without initializing the new elements
+		** Same as resize, except that when the container grows and value_type is
+		** trivially default constructible (int, char, float, POD structs...), the new elements
+		** are left uninitialized instead of being copied from a value:
+		** they're meant to be overwritten right away (e.g. by read() or a decoder).
+		** Other types are value-initialized, like resize does.
+		** Reading a new element before writing it is undefined behavior.
+		** @param n New container size, expressed in number of elements.
+		** @return void
+		*/
+		void resize_for_overwrite(size_type n)
+		{
+			if (n <= this->size())
+			{
+				this->erase(this->begin() + n, this->end());
+				return ;
+			}
+			this->append_n(n - this->size());
+		}
+
 		/*
 		** Test whether Vector is empty
 		** Returns whether the Vector is empty (i.e. whether its size is 0).
@@ -547,6 +591,8 @@ class Vector
 		** In the range version (1), the new contents are elements constructed from
 		** each of the elements in the range between first and last, in the same order.
 		** If a reallocation happens,the storage needed is allocated using the internal allocator.
+		** Forward iterators are measured first so the storage is allocated once,
+		** input iterators (that can be walked only once) are appended with the geometric growth.
 		** @param first Input iterators to the initial positions in a sequence
 		** @param last Input iterators to the final positions in a sequence
 		** @return void
@@ -558,19 +604,7 @@ class Vector
 				typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type = InputIterator()
 				)
 		{
-			size_type	distance;
-			size_type	i;
-
-			distance = std::distance(first, last);
-			if (this->size() > distance)
-				this->_destroy(distance, this->size());
-			if (distance > this->capacity())
-				this->reserve(distance);
-			this->_destroy(0, this->size());
-			this->_size = distance;
-			i = -1;
-			while(first != last)
-				this->_alloc.construct(&this->_v[++i], *(first++));
+			this->_assign_range(first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
 		}
 
 		/*
@@ -587,8 +621,7 @@ class Vector
 		{
 			if (n < this->size())
 				this->_destroy(n, this->size());
-			if (n > this->capacity())
-				this->reserve(n);
+			this->_grow(n, 0);
 			this->_destroy(0, this->size());
 			this->_size = n;
 			for (size_type i = 0; i < n; i++)
@@ -605,17 +638,108 @@ class Vector
 		** @return void
 		*/
 		void push_back (const value_type& val)
+		{
+			/*
+			** growing the storage would free val if it's one of our elements
+			*/
+			if (this->size() == this->capacity() && this->_is_inside(val))
+			{
+				this->push_back(value_type(val));
+				return ;
+			}
+			this->_grow(this->size() + 1, this->capacity());
+			this->_alloc.construct(&this->_v[this->_size++], val);
+		}
+
+# if __FT_CXX11__
+		/*
+		** Adds a new element at the end of the Vector, moving val into it (C++11).
+		** @param val Value to be moved to the new element.
+		** @return void
+		*/
+		void push_back (value_type&& val)
+		{
+			this->emplace_back(std::move(val));
+		}
+
+		/*
+		** Construct and insert element at the end (C++11)
+		** The new element is constructed in place using args as the arguments for its constructor.
+		** @param args Arguments forwarded to construct the new element.
+		** @return A reference to the new element.
+		*/
+		template <class... Args>
+		reference emplace_back (Args&&... args)
 		{
 			if (this->size() == this->capacity())
 			{
 				/*
-				** the condition this->capacity() == 0 is set in case the capacity is zero
-				** so in this case, the multiplication of this->capacity() * __VECTOR_GROWTH_SIZE__ is 0
-				** that's why we add 1 since we cannot reserve a capacity of 0
+				** args may refer to our elements, build the value before growing the storage
 				*/
-				this->reserve((this->capacity() * __VECTOR_GROWTH_SIZE__) + (this->capacity() == 0));
+				value_type tmp(std::forward<Args>(args)...);
+
+				this->_grow(this->size() + 1, this->capacity());
+				this->_alloc.construct(&this->_v[this->_size], std::move(tmp));
 			}
-			this->_alloc.construct(&this->_v[this->_size++], val);
+			else
+				this->_alloc.construct(&this->_v[this->_size], std::forward<Args>(args)...);
+			return (this->_v[this->_size++]);
+		}
+# endif
+
+		/*
+		** Append uninitialized elements
+		** Grows the container by count elements, following the growth policy
+		** (so appending chunk after chunk stays amortized constant per element),
+		** the new elements are default-initialized: left untouched for a
+		** trivially default constructible value_type, value-initialized otherwise.
+		** @param count Number of elements to append.
+		** @return A pointer to the first appended element, ready to be written.
+		*/
+		pointer append_n(size_type count)
+		{
+			size_type	pos;
+
+			pos = this->size();
+			this->_grow(this->size() + count, this->capacity());
+			this->_default_init(pos, pos + count);
+			this->_size += count;
+			return (this->_v + pos);
+		}
+
+		/*
+		** Append a contiguous block
+		** Copies the count elements starting at ptr to the end of the Vector,
+		** the storage grows at most once and trivially copyable elements
+		** are copied with a single memcpy.
+		** ptr may point inside the Vector itself.
+		** @param ptr pointer to the first element to copy
+		** @param count Number of elements to copy.
+		** @return void
+		*/
+		void append(const value_type *ptr, size_type count)
+		{
+			size_type	offset;
+
+			if (!count)
+				return ;
+			/*
+			** growing the storage would free the source if it's made of our elements
+			*/
+			if (this->size() + count > this->capacity() && this->_is_inside(*ptr))
+			{
+				offset = ptr - this->_v;
+				this->_grow(this->size() + count, this->capacity());
+				ptr = this->_v + offset;
+			}
+			else
+				this->_grow(this->size() + count, this->capacity());
+			if (ft::is_trivially_copyable<value_type>::value)
+				std::memcpy(static_cast<void *>(this->_v + this->size()), static_cast<const void *>(ptr), count * sizeof(value_type));
+			else
+				for (size_type i = 0; i < count; i++)
+					this->_alloc.construct(&this->_v[this->size() + i], ptr[i]);
+			this->_size += count;
 		}
 
 		/*
@@ -654,12 +778,60 @@ class Vector
 		{
 			size_type pos;
 
+			/*
+			** val may live inside the Vector, in that case it would be shifted (or freed) by _prepare_insert
+			*/
+			if (this->_is_inside(val))
+				return (this->insert(position, value_type(val)));
 			pos = this->_prepare_insert(position, 1);
 			this->_alloc.construct(&this->_v[pos], val);
 			++this->_size;
 			return (iterator(&this->_v[pos]));
 		}
 		
+# if __FT_CXX11__
+		/*
+		** Insert element (C++11)
+		** Same as insert(position, val), but val is moved into the new element.
+		** @param position Position in the Vector where the new element is inserted.
+		** @param val Value to be moved to the inserted element.
+		** @return An iterator that points to the newly inserted element.
+		*/
+		iterator insert (iterator position, value_type&& val)
+		{
+			return (this->emplace(position, std::move(val)));
+		}
+
+		/*
+		** Construct and insert element (C++11)
+		** The Vector is extended by inserting a new element at position.
+		** This new element is constructed in place using args as the arguments for its construction.
+		** @param position Position in the Vector where the new element is inserted.
+		** @param args Arguments forwarded to construct the new element.
+		** @return An iterator that points to the newly emplaced element.
+		*/
+		template <class... Args>
+		iterator emplace (iterator position, Args&&... args)
+		{
+			size_type pos;
+
+			if (position == this->end() && this->size() < this->capacity())
+			{
+				this->_alloc.construct(&this->_v[this->_size], std::forward<Args>(args)...);
+				return (iterator(&this->_v[this->_size++]));
+			}
+			/*
+			** args may refer to elements that are going to be shifted
+			*/
+			value_type tmp(std::forward<Args>(args)...);
+
+			pos = this->_prepare_insert(position, 1);
+			this->_alloc.construct(&this->_v[pos], std::move(tmp));
+			++this->_size;
+			return (iterator(&this->_v[pos]));
+		}
+# endif
+
 		/*
 		** Insert elements
 		** The Vector is extended by inserting new elements before the element at the specified position,
@@ -681,12 +853,14 @@ class Vector
 		void insert (iterator position,size_type n, const value_type& val)
 		{
 			size_type pos;
-			size_type i;
 
-			pos = (this->_prepare_insert(position, n));
-			i = n;
-			while (i--)
-				this->_alloc.construct(&this->_v[pos--], val);
+			if (this->_is_inside(val))
+			{
+				this->insert(position, n, value_type(val));
+				return ;
+			}
+			pos = this->_prepare_insert(position, n);
+			this->_fill(pos, pos + n, val);
 			this->_size += n;
 		}
 		
@@ -716,14 +890,7 @@ class Vector
 					typename ft::enable_if<!(ft::is_integral<InputIterator>::value), InputIterator>::type = InputIterator()
 					)
 		{
-			size_type pos;
-			size_type distance;
-
-			distance = std::distance(first, last);
-			pos = this->_prepare_insert(position, distance);
-			while (first != last--)
-				this->_alloc.construct(&this->_v[pos--], *(last));
-			this->_size += distance;
+			this->_insert_range(position, first, last, typename ft::iterator_traits<InputIterator>::iterator_category());
 		}
 
 
@@ -742,17 +909,7 @@ class Vector
 		*/
 		iterator erase (iterator position)
 		{
-			size_type distance;
-			size_type i;
-
-			distance = std::distance(this->begin(), position);
-			this->_alloc.destroy(&this->_v[distance]);
-			i = distance;
-			for (; i < this->size() - 1; i++)
-				this->_v[i] = this->_v[i + 1];
-			this->_alloc.destroy(&this->_v[i]);
-			--this->_size;
-			return (iterator(&this->_v[distance]));
+			return (this->erase(position, position + 1));
 		}
 
 		/*
@@ -771,26 +928,11 @@ class Vector
 		*/
 		iterator erase (iterator first, iterator last)
 		{
-			size_type	first_element_dst;
-			size_type	last_element_dst;
-			size_type	first_it;
-			size_type	last_it;
-			
-			first_element_dst = std::distance(this->begin(), first);
-			last_element_dst = std::distance(this->begin(), last);
-			while (first != last)
-			{
-				this->_alloc.destroy(&(*first));
-				++first;
-			}
-			first_it = first_element_dst;
-			last_it = last_element_dst;
-			while (last_it < this->size())
-				this->_v[first_it++] = this->_v[last_it++];
-			while (first_it < this->size())
-				this->_alloc.destroy(&this->_v[first_it++]);
-			this->_size -= (last_element_dst - first_element_dst);
-			return (iterator(&this->_v[first_element_dst]));
+			value_type	*end;
+
+			end = ft::erase_shift_left(this->_alloc, first.base(), last.base(), this->_v + this->size());
+			this->_size = end - this->_v;
+			return (first);
 		}
 
 		/*
@@ -840,7 +982,8 @@ class Vector
 		*/
 		void clear()
 		{
-			this->erase(this->begin(), this->end());
+			this->_destroy(0, this->size());
+			this->_size = 0;
 		}
 
 		/* ======================== */
@@ -893,6 +1036,32 @@ class Vector
 				this->_alloc.construct(&this->_v[i], x[i]);
 			return (*this);
 		}
+
+# if __FT_CXX11__
+		/*
+		** move assignment (C++11)
+		** Releases the current content and steals the storage of x, which is left empty.
+		** @param x A Vector object of the same type
+		** @return *this
+		*/
+		Vector& operator= (Vector&& x)
+		{
+			if (this == &x)
+				return (*this);
+			this->clear();
+			if (this->capacity())
+				this->_alloc.deallocate(this->_v, this->capacity());
+			this->_v = x._v;
+			this->_capacity = x._capacity;
+			this->_size = x._size;
+			this->_alloc = x._alloc;
+			x._v = nullptr;
+			x._capacity = 0;
+			x._size = 0;
+			return (*this);
+		}
+# endif
+
 		/* ============================== HELPER FUNCTIONS ============================== */
 		private:
 			/*
@@ -902,12 +1071,26 @@ class Vector
 			** @param val default value to be in place
 			** @return void
 			*/
-			void	_fill(std::size_t start, std::size_t end, value_type &val)
+			void	_fill(std::size_t start, std::size_t end, const value_type &val)
 			{
 				for (; start < end; start++)
 					this->_alloc.construct(&this->_v[start], val);
 			}
 
+			/*
+			** This function will default-initialize the array from [start, end)
+			** trivially default constructible elements are left as is
+			** @param start starting position
+			** @param end ending position
+			** @return void
+			*/
+			void	_default_init(std::size_t start, std::size_t end)
+			{
+				if (ft::is_trivially_default_constructible<value_type>::value)
+					return ;
+				this->_fill(start, end, value_type());
+			}
+
 			/*
 			** This function will destroy the array from [start, end)
 			** @param start starting position
@@ -920,6 +1103,20 @@ class Vector
 					this->_alloc.destroy(&this->_v[start]);
 			}
 
+			/*
+			** Make sure the storage can hold at least n elements,
+			** the new capacity is chosen by the growth policy
+			** @param n number of elements the storage must be able to hold
+			** @param from capacity the policy grows from (0 when the current content is discarded)
+			** @return void
+			*/
+			void	_grow(size_type n, size_type from)
+			{
+				if (n <= this->capacity())
+					return ;
+				this->reserve(Growth::template next_capacity<value_type>(from, n));
+			}
+
 			/*
 			** reallocating the array and make the capacity bigger to fit n element
 			** @param n new capacity
@@ -932,12 +1129,26 @@ class Vector
 				if (n == this->capacity())
 					return ;
 
-				tmp = this->_alloc.allocate(n);
-				for (size_type i = 0; i < this->size(); i++)
+				/*
+				** if the allocator knows how to resize its blocks (see allocator_reallocate.hpp),
+				** let it try to grow the current one before allocating a new buffer
+				*/
+				if (ft::is_trivially_relocatable<value_type>::value && this->capacity())
 				{
-					this->_alloc.construct(&tmp[i], this->_v[i]);
-					this->_alloc.destroy(&this->_v[i]);
+					tmp = ft::try_reallocate(this->_alloc, this->_v, this->capacity(), n);
+					if (tmp)
+					{
+						this->_v = tmp;
+						this->_capacity = n;
+						return ;
+					}
 				}
+				tmp = this->_alloc.allocate(n);
+				/*
+				** trivially relocatable elements are moved with a single memcpy,
+				** the others are copy constructed then destroyed one by one
+				*/
+				ft::uninitialized_relocate(this->_alloc, this->_v, this->_v + this->size(), tmp);
 				if (this->capacity())
 					this->_alloc.deallocate(this->_v, this->capacity());
 				this->_v = tmp;
@@ -945,42 +1156,135 @@ class Vector
 			}
 
 			/*
-			** Insert elements
-			** The Vector is extended by inserting new elements before the element at the specified position,
-			** effectively increasing the container size by the number of elements inserted.
-			** This causes an automatic reallocation of the allocated storage
-			** space if -and only if- the new Vector size surpasses the current Vector capacity.
-			** Because Vectors use an array as their underlying storage,
-			** inserting elements in positions other than the Vector end causes
-			** the container to relocate all the elements that were after
-			** position to their new positions. This is generally an inefficient operation
-			** compared to the one performed for the same operation by other
-			** kinds of sequence containers (such as list or forward_list).
-			** The parameters determine how many elements are inserted and to which values they are initialized:
+			** assign for input iterators, the range can be walked only once
+			** so its elements are appended one by one
+			** @param first Input iterators to the initial positions in a sequence
+			** @param last Input iterators to the final positions in a sequence
+			** @return void
+			*/
+			template <class InputIterator>
+			void	_assign_range(InputIterator first, InputIterator last, std::input_iterator_tag)
+			{
+				this->clear();
+				for (; first != last; ++first)
+					this->push_back(*first);
+			}
+
+			/*
+			** assign for forward iterators, the storage is allocated once
+			** and contiguous ranges of trivially copyable elements are copied with a single memcpy
+			** @param first Forward iterators to the initial positions in a sequence
+			** @param last Forward iterators to the final positions in a sequence
+			** @return void
+			*/
+			template <class ForwardIterator>
+			void	_assign_range(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+			{
+				size_type	n;
+
+				n = std::distance(first, last);
+				this->clear();
+				this->_grow(n, 0);
+				ft::uninitialized_copy(this->_alloc, first, last, this->_v);
+				this->_size = n;
+			}
+
+			/*
+			** insert for input iterators, the range can be walked only once:
+			** at the end, its elements are appended one by one, elsewhere they're first
+			** gathered in a temporary Vector and then relocated into a single gap
 			** @param position Position in the Vector where the new elements are inserted.
-			** @param n Number of elements to insert. Each element is initialized to a copy of val.
-			** @param val Value to be copied (or moved) to the inserted elements.
+			** @param first Input iterators to the initial positions in a sequence
+			** @param last Input iterators to the final positions in a sequence
 			** @return void
 			*/
+			template <class InputIterator>
+			void	_insert_range(iterator position, InputIterator first, InputIterator last, std::input_iterator_tag)
+			{
+				size_type	pos;
+
+				if (position == this->end())
+				{
+					for (; first != last; ++first)
+						this->push_back(*first);
+					return ;
+				}
+				Vector tmp(first, last, this->_alloc);
+
+				pos = this->_prepare_insert(position, tmp.size());
+				ft::uninitialized_relocate(this->_alloc, tmp._v, tmp._v + tmp.size(), this->_v + pos);
+				this->_size += tmp.size();
+				tmp._size = 0;
+			}
+
+			/*
+			** insert for forward iterators, the gap is opened once
+			** and contiguous ranges of trivially copyable elements are copied with a single memcpy
+			** @param position Position in the Vector where the new elements are inserted.
+			** @param first Forward iterators to the initial positions in a sequence
+			** @param last Forward iterators to the final positions in a sequence
+			** @return void
+			*/
+			template <class ForwardIterator>
+			void	_insert_range(iterator position, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag)
+			{
+				size_type	pos;
+				size_type	n;
+
+				n = std::distance(first, last);
+				pos = this->_prepare_insert(position, n);
+				ft::uninitialized_copy(this->_alloc, first, last, this->_v + pos);
+				this->_size += n;
+			}
+
+			/*
+			** check if val is one of the elements of the Vector
+			** @param val the value to check
+			** @return true if val is stored in [begin, end), otherwise false
+			*/
+			bool	_is_inside(const value_type &val) const
+			{
+				return (this->size() && &val >= this->_v && &val < this->_v + this->size());
+			}
+
+			/*
+			** Open a gap of n uninitialized slots before position,
+			** the elements after position are shifted to the right in a single pass.
+			** If the storage is too small, a single new buffer is allocated and each element is
+			** relocated directly to its final place, on both sides of the gap.
+			** The caller is responsible for constructing the n new elements and updating the size.
+			** @param position Position in the Vector where the new elements are inserted.
+			** @param n Number of elements to insert.
+			** @return the index of the first slot of the gap
+			*/
 			size_type _prepare_insert (iterator position, size_type n)
 			{
-				size_type	distance;
-				size_type	i;
-				size_type	n_element;
+				size_type	pos;
+				size_type	new_capacity;
+				value_type	*tmp;
 
-				n_element = n;
-				distance = std::distance(this->begin(), position);
+				pos = std::distance(this->begin(), position);
 				if (this->size() + n > this->capacity())
-					this->reserve(((this->capacity() * 2) > this->size() + n) ? (this->capacity() * 2) : this->size() + n);
-				/*
-				** Here I substract a 1 since we will start the process from 0
-				*/
-				i = this->size() + n - 1;
-				for (size_type j = 0; j < n; j++)
-					this->_alloc.construct(&this->_v[this->size() + j], value_type());
-				for (; i >= distance + n; i--)
-					std::swap(this->_v[i], this->_v[i - n]);
-				return (i);
+				{
+					new_capacity = Growth::template next_capacity<value_type>(this->capacity(), this->size() + n);
+					/*
+					** an allocator able to grow the block in place does better with the plain reserve + shift
+					*/
+					if (!(ft::is_trivially_relocatable<value_type>::value && ft::has_reallocate<allocator_type>::value))
+					{
+						tmp = this->_alloc.allocate(new_capacity);
+						ft::uninitialized_relocate(this->_alloc, this->_v, this->_v + pos, tmp);
+						ft::uninitialized_relocate(this->_alloc, this->_v + pos, this->_v + this->size(), tmp + pos + n);
+						if (this->capacity())
+							this->_alloc.deallocate(this->_v, this->capacity());
+						this->_v = tmp;
+						this->_capacity = new_capacity;
+						return (pos);
+					}
+					this->reserve(new_capacity);
+				}
+				ft::uninitialized_shift_right(this->_alloc, this->_v + pos, this->_v + this->size(), n);
+				return (pos);
 			}
 };
 
@@ -1002,8 +1306,8 @@ class Vector
 ** @param y Vector containers of the same type
 ** @return void
 */
-template <class T, class Alloc>
-void swap (Vector<T,Alloc>& x, Vector<T,Alloc>& y)
+template <class T, class Alloc, class Growth>
+void swap (Vector<T,Alloc,Growth>& x, Vector<T,Alloc,Growth>& y)
 {
 	x.swap(y);
 }
@@ -1023,41 +1327,41 @@ void swap (Vector<T,Alloc>& x, Vector<T,Alloc>& y)
 ** @param rhs Vector containers
 ** @return true if the condition holds, and false otherwise.
 */
-template <class T, class Alloc>
-bool operator== (const Vector<T,Alloc>& lhs, const Vector<T,Alloc>& rhs)
+template <class T, class Alloc, class Growth>
+bool operator== (const Vector<T,Alloc,Growth>& lhs, const Vector<T,Alloc,Growth>& rhs)
 {
 	if (lhs.size() != rhs.size())
 		return (false);
 	return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
 }
-template <class T, class Alloc>
-bool operator!= (const Vector<T,Alloc>& lhs, const Vector<T,Alloc>& rhs)
+template <class T, class Alloc, class Growth>
+bool operator!= (const Vector<T,Alloc,Growth>& lhs, const Vector<T,Alloc,Growth>& rhs)
 {
 	return !(lhs == rhs);
 }
 
-template <class T, class Alloc>
-bool operator<  (const Vector<T,Alloc>& lhs, const Vector<T,Alloc>& rhs)
+template <class T, class Alloc, class Growth>
+bool operator<  (const Vector<T,Alloc,Growth>& lhs, const Vector<T,Alloc,Growth>& rhs)
 {
 	return (ft::lexicographical_compare(
 			lhs.begin(),lhs.end(),
 			rhs.begin(), rhs.end()));
 }
 
-template <class T, class Alloc>
-bool operator<= (const Vector<T,Alloc>& lhs, const Vector<T,Alloc>& rhs)
+template <class T, class Alloc, class Growth>
+bool operator<= (const Vector<T,Alloc,Growth>& lhs, const Vector<T,Alloc,Growth>& rhs)
 {
 	return (!(rhs < lhs));
 }
 
-template <class T, class Alloc>
-bool operator>  (const Vector<T,Alloc>& lhs, const Vector<T,Alloc>& rhs)
+template <class T, class Alloc, class Growth>
+bool operator>  (const Vector<T,Alloc,Growth>& lhs, const Vector<T,Alloc,Growth>& rhs)
 {
 	return (rhs < lhs);
 }
 
-template <class T, class Alloc>
-bool operator>= (const Vector<T,Alloc>& lhs, const Vector<T,Alloc>& rhs)
+template <class T, class Alloc, class Growth>
+bool operator>= (const Vector<T,Alloc,Growth>& lhs, const Vector<T,Alloc,Growth>& rhs)
 {
 	return (!(rhs > lhs));
 }
@@ -20,10 +20,11 @@
 # pragma once
 
 # include "../Utility/avl.hpp"
+# include "../Utility/sorted_unique.hpp"
+# include "../Utility/algorithms.hpp"
 # include "../Utility/Iterators/iterator_traits.hpp"
 # include "../Utility/Iterators/bidirectional_iterator.hpp"
 # include "../Utility/Iterators/reverse_iterator.hpp"
-# include "./vector.hpp"
 # include <functional>
 
 namespace ft
@@ -32,14 +33,15 @@ namespace ft
 template < class Key,											// Map::key_type
            class T,												// Map::Mapped_type
            class Compare = std::less<Key>,						// Map::key_compare
-           class Alloc = std::allocator<pair<const Key,T> >		// Map::allocator_type
+           class Alloc = typename ft::default_map_allocator<pair<const Key,T> >::type,		// Map::allocator_type
+           class Augment = ft::no_augmentation								// see avl_augmentation.hpp
            >
 class Map
 {
 	/* ============================== MEMBER TYPE ============================== */
 	private:
-		typedef typename	ft::AVL<Key, T, Compare, Alloc>::node				node;
-		typedef typename	ft::AVL<Key, const T, Compare, Alloc>::node			const_node;
+		typedef typename	ft::AVL<Key, T, Compare, Alloc, Augment>::node			node;
+		typedef typename	ft::AVL<Key, const T, Compare, Alloc, Augment>::node	const_node;
 
 	public:
 		typedef				Key													key_type;
@@ -80,7 +82,7 @@ class Map
 
 	/* ============================== MEMBER ATTRIBUTES ============================== */
 	private:
-		ft::AVL<Key, T, Compare, Alloc>	_tree;
+		ft::AVL<Key, T, Compare, Alloc, Augment>	_tree;
 		key_compare						_key_comp;
 		allocator_type					_alloc;
 		size_type						_size;
@@ -96,7 +98,7 @@ class Map
 		explicit Map (
 				const key_compare& comp = key_compare(),
 				const allocator_type& alloc = allocator_type()
-				) : _key_comp(comp), _alloc(alloc), _size(0)
+				) : _tree(comp, alloc), _key_comp(comp), _alloc(alloc), _size(0)
 		{
 		}
 
@@ -112,18 +114,38 @@ class Map
 			InputIterator first,
 			InputIterator last,
 			const key_compare& comp = key_compare(),
-			const allocator_type& alloc = allocator_type()) : _key_comp(comp), _alloc(alloc), _size(0)
+			const allocator_type& alloc = allocator_type()) : _tree(comp, alloc), _key_comp(comp), _alloc(alloc), _size(0)
 		{
 			this->insert(first, last);
 		}
 
+		/*
+		** Constructs a Map container object from a range sorted by key and without duplicates, in O(n)
+		** @param tag ft::sorted_unique, the range isn't checked
+		** @param first Input iterators to the initial positions in a range.
+		** @param last Input iterators to the final positions in a range.
+		** @param comp Binary predicate that, taking two element keys as argument, returns true if the first argument goes before the second argument in the strict weak ordering it defines, and false otherwise.
+		** @param alloc Allocator object.
+		*/
+		template <class InputIterator>
+		Map (
+			ft::sorted_unique_t tag,
+			InputIterator first,
+			InputIterator last,
+			const key_compare& comp = key_compare(),
+			const allocator_type& alloc = allocator_type()) : _tree(comp, alloc), _key_comp(comp), _alloc(alloc), _size(0)
+		{
+			(void)tag;
+			this->_size = this->_tree.build_sorted(first, last, false);
+		}
+
 		/*
 		** Constructs a Map container object, initializing its contents depending on the constructor version used
 		** @param x Another Map object of the same type
 		*/
 		Map (const Map& x)
+		: _tree(x._tree), _key_comp(x._key_comp), _alloc(x._alloc), _size(x._size)
 		{
-			(*this) = x;
 		}
 
 		/*
@@ -340,14 +362,12 @@ class Map
 		*/
 		pair<iterator,bool> insert (const value_type& val)
 		{
-			node	*tmp;
+			pair<node *, bool>	ret;
 
-			tmp = this->_tree.search(val.first);
-			this->_tree.insert(val);
-			if (tmp)
-				return (pair<iterator, bool>(tmp, false));
-			++this->_size;
-			return (pair<iterator, bool>(this->_tree.search(val.first), true));
+			ret = this->_tree.insert_unique(val);
+			if (ret.second)
+				++this->_size;
+			return (pair<iterator, bool>(ret.first, ret.second));
 		}
 
 		/*
@@ -366,8 +386,12 @@ class Map
 		*/
 		iterator insert (iterator position, const value_type& val)
 		{
-			(void) position;
-			return (this->insert(val).first);
+			pair<node *, bool>	ret;
+
+			ret = this->_tree.insert_hint(position.base(), val);
+			if (ret.second)
+				++this->_size;
+			return (iterator(ret.first));
 		}
 
 		/*
@@ -387,6 +411,12 @@ class Map
 		template <class InputIterator>
 		void insert (InputIterator first, InputIterator last)
 		{
+			/*
+			** an empty Map is built in O(n) from the sorted and unique prefix of the range,
+			** the rest (if any) is inserted element by element
+			*/
+			if (!this->_size)
+				this->_size = this->_tree.build_sorted(first, last, true);
 			while (first != last)
 				this->insert(*(first++));
 		}
@@ -400,11 +430,8 @@ class Map
 		*/
 		void erase (iterator position)
 		{
-			if (this->_tree.search((*position).first))
-			{
-				this->_tree.delete_node((*position).first);
-				--this->_size;
-			}
+			this->_tree.delete_node(position.base());
+			--this->_size;
 		}
 
 		/*
@@ -416,9 +443,12 @@ class Map
 		*/
 		size_type erase (const key_type& k)
 		{
-			if (this->_tree.search(k))
+			node	*target;
+
+			target = this->_tree.search(k);
+			if (target)
 			{
-				this->_tree.delete_node(k);
+				this->_tree.delete_node(target);
 				--this->_size;
 				return (1);
 			}
@@ -435,13 +465,10 @@ class Map
 		*/
     	void erase (iterator first, iterator last)
 		{
-			ft::Vector<key_type> tmp;
-			typename ft::Vector<key_type>::iterator it;
-
-			while (first != last)
-				tmp.push_back((first++)->first);
-			for (it = tmp.begin(); it != tmp.end(); it++)
-				this->erase(*it);
+			if (first == this->begin() && last == this->end())
+				return (this->clear());
+			if (first != last)
+				this->_size -= this->_tree.delete_range(first.base(), last.base());
 		}
 
 		/*
@@ -469,7 +496,8 @@ class Map
 		*/
 		void clear()
 		{
-			this->erase(this->begin(), this->end());
+			this->_tree.clear();
+			this->_size = 0;
 		}
 
 		/* =================== */
@@ -689,6 +717,124 @@ class Map
 		{
 			return (ft::make_pair(this->lower_bound(k), this->upper_bound(k)));
 		}
+		/* ========================== */
+		/* ==== ORDER STATISTICS ==== */
+		/* ========================== */
+		/*
+		** These need a Map augmented with ft::subtree_size (see avl_augmentation.hpp),
+		** they all run in O(log n).
+		*/
+		/*
+		** Get the element at a position
+		** @param k position of the element in the order of the keys, starting at 0
+		** @return an iterator to the element, or Map::end if k is not lower than the size
+		*/
+		iterator nth (size_type k)
+		{
+			if (k >= this->_size)
+				return (this->end());
+			return (iterator(this->_tree.select(k)));
+		}
+
+		/*
+		** Get the element at a position
+		** @param k position of the element in the order of the keys, starting at 0
+		** @return an iterator to the element, or Map::end if k is not lower than the size
+		*/
+		const_iterator nth (size_type k) const
+		{
+			if (k >= this->_size)
+				return (this->end());
+			return (const_iterator(this->_tree.select(k)));
+		}
+
+		/*
+		** Count the elements whose key goes before k
+		** @param k Key to rank.
+		** @return the position of k if the container has it, the position it would be inserted at otherwise
+		*/
+		size_type rank (const key_type& k) const
+		{
+			return (this->_tree.rank(k));
+		}
+
+		/*
+		** Count the elements whose key is in [lo, hi)
+		** @param lo Lower bound, included.
+		** @param hi Upper bound, excluded.
+		** @return the number of elements between lo and hi, zero if hi doesn't go after lo
+		*/
+		size_type count_range (const key_type& lo, const key_type& hi) const
+		{
+			if (!this->_key_comp(lo, hi))
+				return (0);
+			return (this->_tree.rank(hi) - this->_tree.rank(lo));
+		}
+
+		/*
+		** Aggregate the elements whose key is in [lo, hi)
+		** This one needs a Map augmented with ft::subtree_aggregate.
+		** @param lo Lower bound, included.
+		** @param hi Upper bound, excluded.
+		** @return the monoid of the augmentation folded over the range in the order of the keys, its identity if the range is empty
+		*/
+		typename ft::augmentation_result<Augment>::type aggregate (const key_type& lo, const key_type& hi) const
+		{
+			return (this->_tree.aggregate(lo, hi));
+		}
+
+		/*
+		** Modify the mapped value of k in place and keep the aggregates consistent
+		** Like operator[], the element is inserted (with a value-initialized mapped value) if k isn't there,
+		** then fn is called with a reference to its mapped value, and the aggregates of
+		** the element and of its ancestors are recomputed, in O(log n).
+		** On an aggregated Map, that's the way to modify a mapped value (see refresh otherwise).
+		** @param k Key of the element whose mapped value is modified.
+		** @param fn Function object called as fn(mapped_value).
+		** @return An iterator to the element.
+		*/
+		template <class Function>
+		iterator update (const key_type& k, Function fn)
+		{
+			iterator	it;
+
+			it = this->insert(ft::make_pair(k, Mapped_type())).first;
+			fn(it->second);
+			this->refresh(it);
+			return (it);
+		}
+
+		/*
+		** Add delta to the mapped value of k and keep the aggregates consistent (see update),
+		** the usual update of a running total: m.add(k, v) instead of m[k] += v.
+		** @param k Key of the element whose mapped value is modified.
+		** @param delta Value added to the mapped value.
+		** @return An iterator to the element.
+		*/
+		iterator add (const key_type& k, const Mapped_type& delta)
+		{
+			iterator	it;
+
+			it = this->insert(ft::make_pair(k, Mapped_type())).first;
+			it->second += delta;
+			this->refresh(it);
+			return (it);
+		}
+
+		/*
+		** Update the aggregates after the mapped value of an element has been changed in place
+		** (through operator[], at or an iterator), the map can't see these writes by itself:
+		** until this is called, the aggregates of the ranges holding the element are stale.
+		** update and add do it on their own.
+		** Nothing to do if the Map isn't augmented, or if the augmentation doesn't look at the mapped values.
+		** @param position Iterator to the modified element.
+		** @return void
+		*/
+		void refresh (iterator position)
+		{
+			this->_tree.refresh(position.base());
+		}
+
 		/* =================== */
 		/* ==== ALLOCATOR ==== */
 		/* =================== */
@@ -706,7 +852,6 @@ class Map
 	public:
 		Map& operator= (const Map& x)
 		{
-			this->_alloc = x._alloc;
 			this->_key_comp = x._key_comp;
 			this->_tree = x._tree;
 			this->_size = x._size;
@@ -746,8 +891,8 @@ class Map
 		}
 };
 
-template <class Key, class T, class Compare, class Alloc>
-void swap (Map<Key,T,Compare,Alloc>& x, Map<Key,T,Compare,Alloc>& y)
+template <class Key, class T, class Compare, class Alloc, class Augment>
+void swap (Map<Key,T,Compare,Alloc,Augment>& x, Map<Key,T,Compare,Alloc,Augment>& y)
 {
 	x.swap(y);
 }